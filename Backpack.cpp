@@ -8,129 +8,371 @@
 **				store and read notes, to call the police and to
 **				store and use additional items. The class, through
 **				its callPolice method, handles whether or not the
-**				player guesses the identity of the thief correctly.
-**				The backpack can only hold one extra item at any
-**				given time. 				
+**				player guesses the identity of the thief correctly
+**				(or of every culprit, when there is more than one).
+**				The notepad can also work out who the culprits could
+**				be from the notes (see CulpritSolver).
+**				The number of extra items the backpack can hold at
+**				once is set when it is created (one by default), and
+**				it holds at most one of each item.
 *********************************************************************/
 
 #include "Backpack.hpp"
 #include "Space.hpp"
 #include "Menu.hpp"
+#include "Messages.hpp"
+#include "Fact.hpp"
+#include "Item.hpp"
 #include "Floor.hpp"
 #include "Person.hpp"
-#include "FireworksBox.hpp"
-#include "TruthCandyBox.hpp"
+#include "GuestTable.hpp"
+#include "CulpritSolver.hpp"
+#include "intValid.hpp"
+#include "NameTrie.hpp"
+#include "Snapshot.hpp"
 #include <string>
+#include <string_view>
 #include <vector>
+#include <unordered_map>
+#include <algorithm>
 #include <iostream>
+#include <cstdlib>
+#include <cctype>
+#include <limits>
 
 /******************************************************************
-Default constructor. Sets up the initial values for the member
-variables.
+Default constructor. Sets up a backpack that can hold a single 
+item.
 ******************************************************************/
 
 Backpack::Backpack()
-	: m_hasFireworks{ false }, 
-	  m_hasTruthBar{ false },
-	  m_thiefName{ "" }
+	: Backpack(1)
+{
+}
+
+/******************************************************************
+Constructor. Sets up the initial values for the member variables.
+The single parameter is the most items the backpack can hold at
+once.
+******************************************************************/
+
+Backpack::Backpack(int capacity)
+	: m_items{ 0 }, 
+	  m_numItems{ 0 },
+	  m_capacity{ capacity },
+	  m_guests{ nullptr },
+	  m_clock{ nullptr },
+	  m_policeCalled{ false }
 {
 	std::string notePadOption{ "Read your notepad" };
 	std::string policeOption{ "Call the police" };
 	m_optionsMenu.addOption(notePadOption);
 	m_optionsMenu.addOption(policeOption);	
+
+	m_notePadMenu.addOption("Read all notes");
+	m_notePadMenu.addOption("Read the latest notes");
+	m_notePadMenu.addOption("Read the notes about a guest");
+	m_notePadMenu.addOption("Read the clues");
+	m_notePadMenu.addOption("Read the notes from the last few minutes");
+	m_notePadMenu.addOption("Work out the suspects from the notes");
 }
 
 /******************************************************************
 Adds a note to the notepad. The note added is taken as the single
 parameter and the method has no return value. If the note is an
-empty string, then it is not added.
+empty Fact (FACT_NONE), then it is not added. The indexes of the
+notepad are updated for the new note.
+******************************************************************/
+
+void Backpack::addNote(const Fact &note)
+{
+	if (note.kind == FACT_NONE)
+	{
+		return;
+	}
+
+	int noteInd = m_notePad.size();
+	m_notePad.push_back(note);
+
+	if (note.kind == FACT_CLUE_GENDER || note.kind == FACT_CLUE_LETTER
+		|| note.kind == FACT_GROUP_GENDER || note.kind == FACT_GROUP_LETTER)
+	{
+		m_clueNotes.push_back(noteInd);
+	}
+
+	if (note.guest != Fact::NO_GUEST)
+	{
+		if (note.guest >= static_cast<int>(m_guestNotes.size()))
+		{
+			m_guestNotes.resize(note.guest + 1);
+		}
+
+		// the first note about a guest adds them to the guests
+		// that can be looked up
+		if (m_guestNotes[note.guest].empty())
+		{
+			m_notedGuests.push_back(note.guest);
+			m_notedGuestMenu.addOption(
+				std::string(m_guests->getName(note.guest)));
+			m_guestIdsByName[m_guests->getNameId(note.guest)] = note.guest;
+		}
+		m_guestNotes[note.guest].push_back(noteInd);
+	}
+}
+
+/******************************************************************
+Returns the notes in the notepad, in the order they were taken.
+The method takes no parameters.
+******************************************************************/
+
+const std::vector<Fact>& Backpack::getNotes() const
+{
+	return m_notePad;
+}
+
+/******************************************************************
+Sets the guests of the party that the notes refer to. The single
+parameter points to the guests, indexed by guest id. The guests
+are not owned by the backpack. No return value.
+******************************************************************/
+
+void Backpack::setGuests(const GuestTable* guests)
+{
+	m_guests = guests;
+}
+
+/******************************************************************
+Sets the game clock used to find the notes from the last few 
+minutes. The single parameter points to the current game minute,
+which is not owned by the backpack. No return value.
+******************************************************************/
+
+void Backpack::setClock(const int* minute)
+{
+	m_clock = minute;
+}
+
+/******************************************************************
+Returns the positions in the notepad of the notes about the guest
+whose guest id is the single parameter, oldest first.
+******************************************************************/
+
+const std::vector<int>& Backpack::notesAbout(int guestId) const
+{
+	static const std::vector<int> NO_NOTES;
+
+	if (guestId < 0 || guestId >= static_cast<int>(m_guestNotes.size()))
+	{
+		return NO_NOTES;
+	}
+	return m_guestNotes[guestId];
+}
+
+/******************************************************************
+Returns the guest id of the guest whose name is the single 
+parameter. The name is looked up as its name id. Fact::NO_GUEST 
+is returned if there are no notes about a guest with that name.
 ******************************************************************/
 
-void Backpack::addNote(std::string note)
+int Backpack::guestIdByName(std::string_view name) const
 {
-	if (note != "")
+	auto found = m_guestIdsByName.find(
+		NameInterner::shared().find(name));
+	if (found == m_guestIdsByName.end())
 	{
-		m_notePad.push_back(note);
+		return Fact::NO_GUEST;
 	}
+	return found->second;
+}
+
+/******************************************************************
+Returns the positions in the notepad of the clue notes, oldest 
+first. No parameters.
+******************************************************************/
+
+const std::vector<int>& Backpack::clueNotes() const
+{
+	return m_clueNotes;
+}
+
+/******************************************************************
+Finds the notes taken within a range of game minutes. The first
+parameter is the first minute of the range and the second 
+parameter is the last minute of the range. Returns the position
+of the first note in the range and one past the position of the
+last note in the range (the two are equal if there are no notes
+in the range). Notes are added in time order, so the range is 
+found with a binary search.
+******************************************************************/
+
+std::pair<int, int> Backpack::notesBetween(int fromMinute, 
+	int toMinute) const
+{
+	auto first = std::lower_bound(m_notePad.begin(), m_notePad.end(),
+		fromMinute, [](const Fact &note, int minute) 
+		{ return note.minute < minute; });
+	auto last = std::upper_bound(first, m_notePad.end(),
+		toMinute, [](int minute, const Fact &note) 
+		{ return minute < note.minute; });
+	return std::make_pair(first - m_notePad.begin(), 
+		last - m_notePad.begin());
 }
 
 /******************************************************************
 Adds a contact for the player to have as an option when guessing
-the thief. The method has no return value and has a string 
-parameter representing the name of the contact.
+the thief. The method has no return value and has an int 
+parameter representing the guest id of the contact. A guest that
+is already a contact is not added again.
 ******************************************************************/
 
-void Backpack::addContact(std::string name)
+void Backpack::addContact(int guestId)
 {
-	m_contacts.push_back(name);	
+	if (guestId >= static_cast<int>(m_isContact.size()))
+	{
+		m_isContact.resize(guestId + 1, false);
+	}
+	if (m_isContact[guestId])
+	{
+		return;
+	}
+
+	m_isContact[guestId] = true;
+	m_contacts.push_back(guestId);
+	m_contactMenu.addOption(std::string(m_guests->getName(guestId)));
+	m_contactTrie.add(m_guests->getName(guestId), guestId);
 }
 
 /******************************************************************
 The backpack is opened and the player can read the notepad, call
-the police or use the extra item (if available). The method takes
-in as a parameter a pointer to the Space on which the backpack is
-being used. The method returns an int value representing the 
-outcome fo the action taken after opening the backpack. The return
-values have the following meanings:
-0 - the player called the police but guessed the identity of the 
-thief incorrectly
-1 - the player did not take any action (ex. just read the notepad)
-2 - the player called the police and guessed the identity of the
-thief correctly
-3 - the player used fireworks
-4 - the player used the truth candy bar
+the police or use one of the items held. The method takes in as a
+parameter a pointer to the Space on which the backpack is being 
+used. The method returns the outcome of the action taken after 
+opening the backpack: no action (ex. just reading the notepad), a
+wrong or correct guess of the thief, or the item used.
 ******************************************************************/
 
-int Backpack::open(Space* curSpace)
+BPResult Backpack::open(const Space* curSpace)
 {
-	BPOption userChoice = 
-		static_cast<BPOption>(m_optionsMenu.chooseOption());
-
-	static constexpr int WRONG{ 0 };
-	static constexpr int NOACTION{ 1 };
-	static constexpr int CORRECT{ 2 };
-	static constexpr int FWORKS{ 3 };
-	static constexpr int TBAR{ 4 };
+	int userChoice = m_optionsMenu.chooseOption();
 
 	switch (userChoice)
 	{
 		case NOTEPAD:
 		{
 			printNotes();
-			return NOACTION;
-			break;
+			return BPResult{ BPResult::NO_ACTION };
 		}
 		case POLICE:
 		{
 			int policeVal = callPolice();
 			if (policeVal == 0)
 			{
-				return NOACTION;
+				return BPResult{ BPResult::NO_ACTION };
 			}
 			else if (policeVal == 1)
 			{
-				return CORRECT;
+				return BPResult{ BPResult::CORRECT_GUESS };
 			}
 			else
 			{
-				return WRONG;
+				return BPResult{ BPResult::WRONG_GUESS };
 			}
-			break;
 		}
-		// the last possible option is that the player chose
-		// the extra item
+		// the remaining options are the items held
 		default:
 		{
-			int usedItem = useExtraItem(curSpace);
-			if (usedItem == 0)
+			ItemId item = m_itemOptions[userChoice - FIRST_ITEM];
+			if (!useItem(item, curSpace))
 			{
-				return NOACTION;
+				return BPResult{ BPResult::NO_ACTION };
 			}
-			else
+			return BPResult{ BPResult::USED_ITEM, item };
+		}
+	}
+}
+
+/******************************************************************
+Prompts the player for which notes to read (all of them, the 
+latest few, the notes about one guest, the clues or the notes from
+the last few minutes) and prints them to the console. The player
+can also have the suspects worked out from the notes. The notes
+are found with the notepad indexes, so only the notes shown are
+looked at. The method takes no parameters and has no return value.
+******************************************************************/
+
+void Backpack::printNotes() const
+{
+	static constexpr int MAX_RECENT_MINS{ 60 };
+
+	NoteOption userChoice = 
+		static_cast<NoteOption>(m_notePadMenu.chooseOption());
+
+	switch (userChoice)
+	{
+		case ALL_NOTES:
+		{
+			printNotesHeader(m_notePad.size());
+			for (int i = 0; i < static_cast<int>(m_notePad.size()); i++)
+			{
+				printNote(i);
+			}
+			break;
+		}
+		case LATEST_NOTES:
+		{
+			std::cout << "\nHow many of the latest notes would you like "
+				<< "to read? (1 - " << m_notePad.size() << ")\n";
+			int numNotes = intValid(1, m_notePad.size());
+			printNotesHeader(numNotes);
+			for (int i = m_notePad.size() - numNotes; 
+				i < static_cast<int>(m_notePad.size()); i++)
+			{
+				printNote(i);
+			}
+			break;
+		}
+		case GUEST_NOTES:
+		{
+			if (m_notedGuests.empty())
+			{
+				printNotesHeader(0);
+				break;
+			}
+			std::cout << "\nChoose the guest to read about.\n";
+			int guestId = m_notedGuests[m_notedGuestMenu.chooseOption() - 1];
+			const std::vector<int> &notes = notesAbout(guestId);
+			printNotesHeader(notes.size());
+			for (int noteInd : notes)
+			{
+				printNote(noteInd);
+			}
+			break;
+		}
+		case CLUE_NOTES:
+		{
+			printNotesHeader(m_clueNotes.size());
+			for (int noteInd : m_clueNotes)
+			{
+				printNote(noteInd);
+			}
+			break;
+		}
+		case SUSPECT_NOTES:
+		{
+			printSuspects();
+			break;
+		}
+		default:
+		{
+			std::cout << "\nRead the notes from how many minutes back?"
+				<< " (1 - " << MAX_RECENT_MINS << ")\n";
+			int numMins = intValid(1, MAX_RECENT_MINS);
+			std::pair<int, int> range = 
+				notesBetween(*m_clock - numMins, *m_clock);
+			printNotesHeader(range.second - range.first);
+			for (int i = range.first; i < range.second; i++)
 			{
-				// usedItem will have a value of 1 if fireworks
-				// were used and 2 if truth candy was used
-				return usedItem + 2;	
+				printNote(i);
 			}
 			break;
 		}
@@ -138,191 +380,540 @@ int Backpack::open(Space* curSpace)
 }
 
 /******************************************************************
-Prints all of the notes in the player's notepad to the console. 
-The method takes no parameters and has no return value.
+Prints the heading of the notepad. If the single parameter (the
+number of notes about to be printed) is 0, a message saying there
+are no notes is printed as well. No return value.
 ******************************************************************/
 
-void Backpack::printNotes() const
+void Backpack::printNotesHeader(int numNotes) const
 {
 	std::cout << "\n********************************"
 		<< "\nNOTEPAD\n\n";
-	for (int i = 0; i < m_notePad.size(); i++)
+	if (numNotes == 0)
 	{
-		std::cout << "> " << m_notePad[i] << "\n";
-	}	
+		std::cout << "There are no notes to show.\n";
+	}
 }
 
 /******************************************************************
-Uses the extra item in the backpack (i.e. not the notepad or the
-phone). The single parameter is a pointer to the player's current
-space. The method has an int return value. The possible return 
-values are:
-0 - indicates that the backpack does not currently have an extra
-item or that the extra item could not be used on the current 
-space.
-1 - indicates that fireworks were used
-2 - indicates that a truth candy bar was used 
+Prints a single note to the console. The single parameter is the
+position of the note in the notepad. No return value.
 ******************************************************************/
 
-int Backpack::useExtraItem(Space* curSpace)
+void Backpack::printNote(int noteInd) const
 {
-	static constexpr int CANTUSE = 0;
-	static constexpr int FWORKS = 1;
-	static constexpr int TBAR = 2;
-
-	if (m_hasFireworks)
-	{
-		// the fireworks can only be used on Floor spaces
-		if (curSpace->getType() != Floor::statType())
-		{
-			std::cout << "\nYou could not set off the fireworks. The"
-				<< " fireworks need to be set off on empty\nfloor "
-			  	<< "space.\n";
-			return CANTUSE;
-		} 			
-		
-		std::cout << "\nYou set off the fireworks. There is a "
-			<< "beautiful display of vibrant colors.\nMiraculously,"
-			<< " nothing in the room sets on fire.\n";
-		m_hasFireworks = false;
-		m_optionsMenu.deleteLast();
-		return FWORKS;
+	std::cout << "> ";
+	writeMessage(std::cout, factMessage(m_notePad[noteInd], *m_guests));
+	std::cout << "\n";
+}
+
+/******************************************************************
+Works out which of the player's contacts could be culprits from 
+the notes (see CulpritSolver) and prints them: the contacts that
+fit the notes, and those that must be culprits. Only the contacts
+are looked at, as only they can be named to the police. The 
+method takes no parameters and has no return value.
+******************************************************************/
+
+void Backpack::printSuspects() const
+{
+	CulpritSolver solver;
+	solver.setUp(*m_guests, m_notePad, m_contacts, m_culpritIds.size());
+	std::vector<int> possible;
+	std::vector<int> certain;
+	bool found = solver.narrow(possible, certain);
+
+	printNotesHeader(m_notePad.size());
+	if (m_contacts.size() < m_culpritIds.size())
+	{
+		std::cout << "You haven't met enough of the guests yet to name "
+			<< (m_culpritIds.size() == 1 ? "the thief.\n" 
+				: "all of the culprits.\n");
+		return;
 	}
-	
-	else if (m_hasTruthBar)
+	if (!found)
 	{
-		// truth bars can only be used on Person spaces
-		if (curSpace->getType() != Person::statType())
+		std::cout << "None of the guests you have met fit your notes.\n";
+		return;
+	}
+
+	if (m_culpritIds.size() > 1)
+	{
+		std::cout << "Of the guests you have met, these could be in on "
+			<< "the theft:\n";
+		printNames(possible);
+		if (!certain.empty())
 		{
-			std::cout << "\nYou must be on a space with a guest to"
-				<< " feed them a truth bar.\n";
-			return CANTUSE;
+			std::cout << "These must be in on the theft:\n";
+			printNames(certain);
 		}
+	}
+	else if (possible.size() == 1)
+	{
+		std::cout << "Of the guests you have met, only "
+			<< m_guests->getName(possible[0]) << " fits your notes.\n";
+	}
+	else
+	{
+		std::cout << "Of the guests you have met, these fit your "
+			<< "notes:\n";
+		printNames(possible);
+	}
+}
+
+/******************************************************************
+Prints the names of guests, one to a line. The single parameter 
+holds the guest ids. No return value.
+******************************************************************/
 
-		m_hasTruthBar = false;
+void Backpack::printNames(const std::vector<int> &guestIds) const
+{
+	for (int guestId : guestIds)
+	{
+		std::cout << "> " << m_guests->getName(guestId) << "\n";
+	}
+}
+
+/******************************************************************
+Uses an item in the backpack. The first parameter is the item and
+the second parameter is a pointer to the player's current space.
+The item can only be used if the space meets the item's use 
+condition (see Item.cpp). Returns true if the item was used, in
+which case it is taken out of the backpack.
+******************************************************************/
+
+bool Backpack::useItem(ItemId item, const Space* curSpace)
+{
+	const ItemType &type = getItemType(item);
+	if (!type.canUse(curSpace))
+	{
+		say(Message{ type.cantUseMsg });
+		return false;
+	}
+
+	say(Message{ type.usedMsg });
+	m_items &= ~(1u << item);
+	m_numItems--;
+	updateItemOptions();
+	return true;
+}
+
+/******************************************************************
+Rebuilds the item options at the end of the options menu (after 
+the notepad and police options), one for each item held in item
+id order. Only called when the items held change. No parameters 
+and no return value.
+******************************************************************/
+
+void Backpack::updateItemOptions()
+{
+	while (m_optionsMenu.getNumOptions() >= FIRST_ITEM)
+	{
 		m_optionsMenu.deleteLast();
-		return TBAR;
-	}	
+	}
 
-	// the backpack does not have any extra item
-	else
+	int numOptions = 0;
+	for (int i = 0; i < NUM_ITEMS; i++)
 	{
-		return CANTUSE;
-	}	
+		if (m_items & (1u << i))
+		{
+			ItemId item = static_cast<ItemId>(i);
+			m_itemOptions[numOptions++] = item;
+			m_optionsMenu.addOption(getItemType(item).useOption);
+		}
+	}
 }
 
 /******************************************************************
 Calls the police. This presents the player with the option to
-guess who the thief is. The player can only guess the names of
-guests that the player has met. The method has no parameters
+guess who the thief is. When there is more than one culprit the
+player names as many guests as there are culprits, and the guess
+is only correct if every culprit is named. The player can only 
+guess the names of guests that the player has met (and must have
+met enough of them). The method has no parameters
 and has an int return value. A return value of -1 indicates that 
 the thief was guessed incorrectly and a return value of 1 
 indicates a correct guess. If the player hasn't met anyone yet,
-then the call is not made and the method returns 0.
+or has already called the police, then the call is not made and
+the method returns 0.
 ******************************************************************/
 
-int Backpack::callPolice() const
+int Backpack::callPolice()
 {
 	static constexpr int INCORRECT{ -1 };
 	static constexpr int NOTHING{ 0 };
 	static constexpr int CORRECT{ 1 };
 
+	// the police only take a single guess
+	if (m_policeCalled)
+	{
+		say(Message{ MSG_POLICE_ALREADY_CALLED });
+		return NOTHING;
+	}
+
 	// do nothing if the player hasn't met anyone yet
+	int numCulprits = m_culpritIds.size();
 	if (m_contacts.size() == 0)
 	{
-		std::cout << "\nYou put your phone back in your backpack as "
-			<< "you realize you haven't met anyone\nat the party yet"
-			<< " (and therefore won't have any guess for the identity of"
-			<< " the\nthief).\n";
+		say(Message{ MSG_NO_CONTACTS });
+		return NOTHING;
+	}
+	if (static_cast<int>(m_contacts.size()) < numCulprits)
+	{
+		Message tooFew{ MSG_TOO_FEW_CONTACTS };
+		tooFew.count = numCulprits;
+		say(tooFew);
 		return NOTHING;
 	}
 
-	std::cout << "\nDialing 9-1-1....\n"
-		<< "Operator: 9-1-1 operator. What is your emergency?\n"
-		<< "You: I am at a party and someone has stolen my "
-		<< 	"wallet.\n"
-		<< "Operator: Do you know who stole the wallet?\n";
-	std::cout << "\nYou must guess who at the party stole your"
-		<< " wallet. Choose from one of the guests below.\n";
-	Menu guestMenu;
-	int thiefOpVal = -1;
-	for (int i = 0; i < m_contacts.size(); i++)
+	say(Message{ MSG_POLICE_DIAL });
+	bool searching = static_cast<int>(m_contacts.size()) > MAX_LISTED;
+	Message howToName{ MSG_CHOOSE_THIEF };
+	if (numCulprits == 1)
 	{
-		// store the option value of the thief (if the 
-		// thief has been met by the player
-		if (m_contacts[i] == m_thiefName)
+		howToName.id = searching ? MSG_FIND_THIEF : MSG_CHOOSE_THIEF;
+	}
+	else
+	{
+		howToName.id = searching ? MSG_FIND_CULPRITS : MSG_CHOOSE_CULPRITS;
+		howToName.count = numCulprits;
+	}
+	say(howToName);
+
+	// the contact menu is kept up to date as contacts are added.
+	// Each guest can only be named once.
+	std::vector<int> guessIds;
+	while (static_cast<int>(guessIds.size()) < numCulprits)
+	{
+		int guessId = chooseContact();
+		if (std::find(guessIds.begin(), guessIds.end(), guessId) 
+			!= guessIds.end())
+		{
+			Message namedMsg{ MSG_ALREADY_NAMED };
+			namedMsg.name = m_guests->getNameId(guessId);
+			say(namedMsg);
+			continue;
+		}
+		guessIds.push_back(guessId);
+		if (static_cast<int>(guessIds.size()) < numCulprits)
 		{
-			thiefOpVal = i + 1;
+			say(Message{ MSG_NAME_ANOTHER });
 		}
-		guestMenu.addOption(m_contacts[i]);
 	}
 
-	int playerGuess = guestMenu.chooseOption();
-
-	std::cout << "\nYou: I think that " << m_contacts[playerGuess - 1]
-		<< " stole my wallet!\n"
-		<< "Operator: Okay, we will have a unit there shortly.\n"
-		<< "\nMinutes later, the police arrive at the party.\n";
+	// the guesses are listed as "A, B and C"
+	for (int i = 0; i < numCulprits; i++)
+	{
+		Message guessMsg{ MSG_GUESS_NEXT };
+		if (i == 0)
+		{
+			guessMsg.id = MSG_GUESS_FIRST;
+		}
+		else if (i == numCulprits - 1)
+		{
+			guessMsg.id = MSG_GUESS_LAST;
+		}
+		guessMsg.name = m_guests->getNameId(guessIds[i]);
+		say(guessMsg);
+	}
+	say(Message{ numCulprits == 1 ? MSG_GUESS_THIEF_END 
+		: MSG_GUESS_GROUP_END });
+	m_policeCalled = true;
 	
-	if (playerGuess == thiefOpVal)
-	{			
-		return CORRECT;		
+	// the guesses are all different, so every culprit has been
+	// named if every guess is a culprit
+	for (int guessId : guessIds)
+	{
+		if (std::find(m_culpritIds.begin(), m_culpritIds.end(), guessId)
+			== m_culpritIds.end())
+		{
+			return INCORRECT;
+		}
 	}
+	return CORRECT;
+}
 
-	else
-	{	
-		return INCORRECT;
-	}		
+/******************************************************************
+Has the player choose one of the contacts. The contacts are listed
+in the contact menu if there are only a few of them, and otherwise
+the player searches for the name (see searchContact). No 
+parameters. Returns the guest id of the contact chosen.
+******************************************************************/
+
+int Backpack::chooseContact() const
+{
+	if (static_cast<int>(m_contacts.size()) <= MAX_LISTED)
+	{
+		return m_contacts[m_contactMenu.chooseOption() - 1];
+	}
+	return searchContact();
 }
 
 /******************************************************************
-Setter method for the m_thiefName variable.
+Has the player find one of the contacts by name. The player types
+the start of the name and can keep typing more letters to narrow
+the search, each entry carrying on from the letters typed so far
+(so each letter costs a single step through the contact trie, 
+however many contacts there are). Once few enough contacts match
+they are listed, and the player chooses one by its number. Typing
+'*' starts the search again. No parameters. Returns the guest id
+of the contact chosen.
 ******************************************************************/
 
-void Backpack::setThief(std::string thiefName)
+int Backpack::searchContact() const
 {
-	m_thiefName = thiefName;
+	std::string typed;
+	int node = NameTrie::ROOT;
+	std::vector<int> listed;
+	while (true)
+	{
+		int numMatches = m_contactTrie.count(node);
+		listed.clear();
+		if (numMatches <= MAX_LISTED)
+		{
+			m_contactTrie.collect(node, numMatches, listed);
+			std::cout << "\n";
+			for (int i = 0; i < numMatches; i++)
+			{
+				std::cout << "(" << i + 1 << ") " 
+					<< m_guests->getName(listed[i]) << "\n";
+			}
+			std::cout << "Choose a guest, or type more of the name:\n";
+		}
+		else if (typed.empty())
+		{
+			std::cout << "\nYou have met " << numMatches << " guests. "
+				<< "Type the start of the guest's name:\n";
+		}
+		else
+		{
+			std::cout << "\n" << numMatches << " guests you have met have "
+				<< "a name starting with '" << typed << "'.\nType more "
+				<< "of the name ('*' to start again):\n";
+		}
+
+		std::string entry = textValid();
+		if (entry == "*")
+		{
+			typed.clear();
+			node = NameTrie::ROOT;
+			continue;
+		}
+		if (!entry.empty() && isdigit(static_cast<unsigned char>(entry[0])))
+		{
+			int choice = atoi(entry.c_str());
+			if (choice >= 1 && choice <= static_cast<int>(listed.size()))
+			{
+				return listed[choice - 1];
+			}
+			std::cout << "That is not one of the guests listed.\n";
+			continue;
+		}
+
+		int next = m_contactTrie.follow(node, entry);
+		if (next == NameTrie::NO_NODE)
+		{
+			std::cout << "You have not met a guest whose name starts "
+				<< "with '" << typed << entry << "'.\n";
+			continue;
+		}
+		typed += entry;
+		node = next;
+	}
 }
 
 /******************************************************************
-Attempts to add an item to the backpack. If the backpack has 
-extra space, the item is added, otherwise the item is not added.
-A message is output to the console in either scenario. The single
-parameter represents as a string the type of item being added.
-The method returns true if the item was added and false if it was
-not added.
+Writes the state of the backpack to a game snapshot (see 
+Snapshot.hpp): the item bits, whether the police were called, the
+contacts in the order they were met and every note. The menus and
+the indexes of the notepad are not saved since they are rebuilt
+from the contacts and notes. No return value.
 ******************************************************************/
 
-bool Backpack::add(std::string itemType)
+void Backpack::save(SnapshotWriter &out) const
 {
-	// constants to add as menu options
-	static const std::string fworksOption{ "Use fireworks" };
-	static const std::string tbarOption{ "Use Truth Candy Bar" };
+	out.putVarint(m_items);
+	out.putVarint(m_policeCalled);
 
-	if (m_hasFireworks || m_hasTruthBar)
+	out.putVarint(m_contacts.size());
+	for (int guestId : m_contacts)
 	{
-		std::cout << "\nYour backpack is full and you are not"
-			<< " able to add the " << itemType << ".\n";
-		return false;
+		out.putVarint(guestId);
 	}
-	
-	else
+
+	out.putVarint(m_notePad.size());
+	for (const Fact &note : m_notePad)
+	{
+		out.putVarint(note.kind);
+		out.putInt(note.guest);
+		out.putInt(note.value);
+		out.putInt(note.minute);
+	}
+}
+
+/******************************************************************
+Restores the state written by save into an empty backpack. The
+guests must already be set, since the contacts and notes are 
+checked against them. The contacts and notes are added in order,
+which rebuilds the menus and the indexes of the notepad. Returns
+false if the snapshot is not valid (ex. it names a guest that is
+not in the party or holds more items than the backpack can).
+******************************************************************/
+
+bool Backpack::restore(SnapshotReader &in)
+{
+	m_items = in.getAtMost((1u << NUM_ITEMS) - 1);
+	m_numItems = 0;
+	for (int i = 0; i < NUM_ITEMS; i++)
+	{
+		m_numItems += (m_items >> i) & 1;
+	}
+	if (m_numItems > m_capacity)
 	{
-		if (itemType == FireworksBox::statItem())
+		in.fail();
+	}
+	updateItemOptions();
+	m_policeCalled = in.getAtMost(1) != 0;
+
+	int numGuests = m_guests->size();
+	int numContacts = in.getAtMost(numGuests);
+	for (int i = 0; i < numContacts && in.ok(); i++)
+	{
+		int guestId = in.getAtMost(numGuests - 1);
+		if (in.ok())
 		{
-			m_hasFireworks = true;
-			m_optionsMenu.addOption(fworksOption);
-			std::cout << "\nYou place the fireworks into your "
-				<< "backpack.\n";	
+			addContact(guestId);
 		}
-		else
+	}
+
+	// the notes are checked before they are narrowed to a Fact, and
+	// must be in the order they were taken (notesBetween relies on it)
+	int numNotes = in.getVarint();
+	int lastMinute = 0;
+	for (int i = 0; i < numNotes && in.ok(); i++)
+	{
+		// the group letter notes are the last kind of fact
+		FactKind kind = static_cast<FactKind>(
+			in.getAtMost(FACT_GROUP_LETTER));
+		int guest = in.getInt();
+		int value = in.getInt();
+		int minute = in.getInt();
+		if (!in.ok() || !validNote(kind, guest, value, numGuests)
+			|| minute < lastMinute 
+			|| minute > std::numeric_limits<short>::max())
 		{
-			m_hasTruthBar = true;
-			m_optionsMenu.addOption(tbarOption);
-			std::cout << "\nYou place the Truth Candy Bar into "
-				<< "your backpack.\n";
+			in.fail();
+			break;
 		}
-		return true;
+
+		Fact note{ kind };
+		note.guest = guest;
+		note.value = value;
+		note.minute = minute;
+		addNote(note);
+		lastMinute = minute;
 	}
+	return in.ok();
 }
 
+/******************************************************************
+Returns true if a note read from a snapshot holds a valid fact.
+The parameters are the kind of fact, its guest id and value (not
+yet narrowed to the Fact fields) and the number of guests. The
+guest must be given for notes about a met guest and left out of
+every other note, and the value must be one the kind can hold
+(see Fact.hpp).
+******************************************************************/
+
+bool Backpack::validNote(FactKind kind, int guest, int value, 
+	int numGuests)
+{
+	bool hasGuest = guest >= 0 && guest < numGuests;
+	bool noGuest = guest == Fact::NO_GUEST;
+	switch (kind)
+	{
+		case FACT_MAP_SYMBOL:
+		{
+			return noGuest && value >= 0 
+				&& value <= MSG_SYMBOL_MET - MSG_SYMBOL_PLAYER;
+		}
+		case FACT_MET_GUEST:
+		{
+			return hasGuest && value == 0;
+		}
+		case FACT_TRUTH:
+		{
+			return hasGuest && (value == 0 || value == 1);
+		}
+		case FACT_GUEST_LEFT:
+		{
+			// guests the player has not met have no guest id
+			return value == 1 ? hasGuest : noGuest && value == 0;
+		}
+		case FACT_CLUE_GENDER:
+		case FACT_GROUP_GENDER:
+		{
+			return noGuest && (value == 0 || value == 1);
+		}
+		case FACT_CLUE_LETTER:
+		case FACT_GROUP_LETTER:
+		{
+			return noGuest && value >= 'a' && value <= 'z';
+		}
+		case FACT_END_TIME:
+		{
+			return noGuest && value >= 0 
+				&& value <= std::numeric_limits<short>::max();
+		}
+		default:
+		{
+			return false;
+		}
+	}
+}
+
+/******************************************************************
+Sets the guest ids of the culprits (the thief and any 
+accomplices). The single parameter holds the guest ids. No return
+value.
+******************************************************************/
+
+void Backpack::setCulprits(const std::vector<int> &culpritIds)
+{
+	m_culpritIds = culpritIds;
+}
+
+/******************************************************************
+Attempts to add an item to the backpack. If the backpack has 
+extra space and does not already hold the item, the item is 
+added, otherwise the item is not added. A message is output to 
+the console saying whether the item was added, the backpack is 
+full or the item is already in the backpack. The single parameter
+is the id of the item being added. The method returns true if the
+item was added and false if it was not added.
+******************************************************************/
+
+bool Backpack::add(ItemId item)
+{
+	const ItemType &type = getItemType(item);
+	if (m_items & (1u << item))
+	{
+		Message heldMsg{ MSG_ITEM_ALREADY_HELD };
+		heldMsg.item = item;
+		say(heldMsg);
+		return false;
+	}
+	if (m_numItems >= m_capacity)
+	{
+		Message fullMsg{ MSG_BACKPACK_FULL };
+		fullMsg.item = item;
+		say(fullMsg);
+		return false;
+	}
+	
+	m_items |= 1u << item;
+	m_numItems++;
+	updateItemOptions();
+	say(Message{ type.addedMsg });
+	return true;
+}
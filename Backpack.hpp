@@ -8,95 +8,258 @@
 **				store and read notes, to call the police and to
 **				store and use additional items. The class, through
 **				its callPolice method, handles whether or not the
-**				player guesses the identity of the thief correctly.
-**				The backpack can only hold one extra item at any
-**				given time. 				
+**				player guesses the identity of the thief correctly
+**				(or of every culprit, when there is more than one).
+**				The notepad can also work out who the culprits could
+**				be from the notes (see CulpritSolver).
+**				The number of extra items the backpack can hold at
+**				once is set when it is created (one by default), and
+**				it holds at most one of each item.
 *********************************************************************/
 
 #ifndef BACKPACK_HPP
 #define BACKPACK_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <unordered_map>
 #include "Space.hpp"
 #include "Menu.hpp"
+#include "Messages.hpp"
+#include "Fact.hpp"
+#include "Item.hpp"
+#include "GuestTable.hpp"
+#include "NameTrie.hpp"
+#include "Snapshot.hpp"
+
+// the outcome of opening the backpack. item is only set when
+// an item was used (it is NUM_ITEMS otherwise).
+struct BPResult {
+	enum Outcome { 
+		NO_ACTION,
+		WRONG_GUESS,
+		CORRECT_GUESS,
+		USED_ITEM
+	};
+
+	Outcome outcome = NO_ACTION;
+	ItemId item = NUM_ITEMS;
+};
 
 class Backpack {
 	private:	
-		// holds true if the player has fireworks in the 
-		// backpack and false if not
-		bool m_hasFireworks;
-		// holds true if the player has a truth candy bar
-		// in the backpack and false if not
-		bool m_hasTruthBar;
-		// holds the name of the thief
-		std::string m_thiefName;
-		// holds the player's notepad as a vector of strings
-		std::vector<std::string> m_notePad;
+		// the items held in the backpack, with the bit for
+		// each item id set if the item is held
+		unsigned int m_items;
+		// the number of items held and the most items that
+		// can be held at once
+		int m_numItems;
+		int m_capacity;
+		// the item used by each item option in the options
+		// menu (in the same order as the options)
+		ItemId m_itemOptions[NUM_ITEMS];
+		// holds the guest ids of the culprits (the thief and
+		// any accomplices)
+		std::vector<int> m_culpritIds;
+		// holds the player's notepad as an append-only log
+		// of facts (only turned into text when the notepad
+		// is read)
+		std::vector<Fact> m_notePad;
+		// the guests of the party (indexed by guest id), used
+		// to show the notes. Not owned by the backpack.
+		const GuestTable* m_guests;
+		// the current game minute. Not owned by the backpack.
+		const int* m_clock;
+
+		// indexes of the notepad, kept up to date as notes are
+		// added. Notes are referred to by their position in the
+		// notepad. Notes are added in time order, so notes in a
+		// time range are found by a binary search on the 
+		// notepad itself.
+		// - the notes about each guest (indexed by guest id)
+		std::vector<std::vector<int>> m_guestNotes;
+		// - the guest ids of the guests with notes, in the order
+		//   they were first noted, along with a menu of their
+		//   names in the same order
+		std::vector<int> m_notedGuests;
+		Menu m_notedGuestMenu;
+		// - the guest id for each name id of a guest with notes
+		std::unordered_map<NameId, int> m_guestIdsByName;
+		// - the clue notes
+		std::vector<int> m_clueNotes;
+		// holds the Menu of ways to read the notepad
+		Menu m_notePadMenu;
 		// hold the player's contacts (i.e. guests met thus
-		// far) as a vector of strings
-		std::vector<std::string> m_contacts;
+		// far) as guest ids in the order they were met. The
+		// second vector holds true for each guest id that is
+		// a contact, and the menu holds the contact names in
+		// the same order as the contacts.
+		std::vector<int> m_contacts;
+		std::vector<bool> m_isContact;
+		Menu m_contactMenu;
+		// the contacts by name, searched when there are too
+		// many contacts to list
+		NameTrie m_contactTrie;
+		// with more contacts than this the player names a 
+		// guest by typing the start of their name (rather than
+		// choosing from the contact menu), and at most this
+		// many matching guests are listed at once
+		static constexpr int MAX_LISTED = 20;
+		// holds true once the player has called the police
+		bool m_policeCalled;
 		// holds the Menu of available options when the
 		// backpack is opened
 		Menu m_optionsMenu;
 		// enum that is used to determine backpack option
+		// selected (the options after POLICE are the items)
+		enum BPOption { NOTEPAD = 1, POLICE, FIRST_ITEM };
+
+		// enum that is used to determine the notepad option
 		// selected
-		enum BPOption { NOTEPAD = 1, POLICE, EXTRA };
+		enum NoteOption { ALL_NOTES = 1, LATEST_NOTES, GUEST_NOTES,
+			CLUE_NOTES, RECENT_NOTES, SUSPECT_NOTES };
 
-		// prints all of the notes in the notepad to the 
-		// console. The method takes no parameters and 
-		// has no return value.
+		// prompts the player for which notes to read and prints
+		// them to the console. The method takes no parameters 
+		// and has no return value.
 		void printNotes() const;
 
-		// Uses the extra item in the backpack (i.e. not 
-		// the notepad or the phone). The method takes as
-		// a parameter a pointer to the player's current
-		// Space. The method returns 0 if the extra item
-		// could not be used, 1 if fireworks were used, and
-		// 2 if a truth candy bar was used. 
-		int useExtraItem(Space* curSpace);
+		// prints the heading of the notepad, or a message if
+		// there are no notes to show (the single parameter is
+		// the number of notes). No return value.
+		void printNotesHeader(int numNotes) const;
+
+		// prints a single note, given as its position in the
+		// notepad. No return value.
+		void printNote(int noteInd) const;
+
+		// works out which of the contacts could be culprits from
+		// the notes and prints them. No parameters and no return
+		// value.
+		void printSuspects() const;
+
+		// prints the names of the guests whose ids are in the
+		// vector passed as the parameter. No return value.
+		void printNames(const std::vector<int> &guestIds) const;
+
+		// has the player choose one of the contacts, from the
+		// contact menu or by searching for the name. Returns the
+		// guest id of the contact chosen.
+		int chooseContact() const;
+
+		// has the player find one of the contacts by typing the
+		// start of the name, a few letters at a time. Returns the
+		// guest id of the contact chosen.
+		int searchContact() const;
+
+		// Uses an item in the backpack. The first parameter is
+		// the item and the second parameter is a pointer to the
+		// player's current Space. The method returns true if 
+		// the item was used.
+		bool useItem(ItemId item, const Space* curSpace);
+
+		// Rebuilds the item options of the options menu after
+		// the items held change. No parameters and no return
+		// value.
+		void updateItemOptions();
+
+		// Returns true if a note read from a snapshot (its kind,
+		// guest id and value, along with the number of guests) 
+		// is a valid fact.
+		static bool validNote(FactKind kind, int guest, int value,
+			int numGuests);
 	public:
-		// default constructor
+		// default constructor, the backpack can hold a single
+		// item
 		Backpack();
 
+		// constructor, the single parameter is the most items
+		// the backpack can hold at once
+		Backpack(int capacity);
+
 		// adds a note the notepad in the backpack. The note
 		// added is taken as the parameter and the method
 		// has no return value.
-		void addNote(std::string note);
+		void addNote(const Fact &note);
+
+		// Returns the notes in the notepad, in the order they
+		// were taken. No parameters.
+		const std::vector<Fact>& getNotes() const;
+
+		// Sets the guests of the party (indexed by guest id)
+		// that the notes refer to. No return value.
+		void setGuests(const GuestTable* guests);
+
+		// Sets the game clock used to find recent notes. The 
+		// clock is not owned by the backpack. No return value.
+		void setClock(const int* minute);
+
+		// Notepad queries. Notes are returned as their positions
+		// in the notepad (see getNotes), oldest first.
+		// Returns the notes about the guest with the given id.
+		const std::vector<int>& notesAbout(int guestId) const;
+
+		// Returns the guest id of the guest with the given name,
+		// or Fact::NO_GUEST if there are no notes about them.
+		int guestIdByName(std::string_view name) const;
+
+		// Returns the clue notes.
+		const std::vector<int>& clueNotes() const;
+
+		// Returns the first note taken at or after the first
+		// parameter (a game minute) and one past the last note
+		// taken at or before the second parameter.
+		std::pair<int, int> notesBetween(int fromMinute, 
+			int toMinute) const;
 
 		// adds a contact for the player to have as an 
 		// option when guessing the thief. The method
-		// has no return value and has a string parameter
-		// representing the name of the contact.
-		void addContact(std::string name);
+		// has no return value and has an int parameter
+		// representing the guest id of the contact. Guests
+		// that are already contacts are not added again.
+		void addContact(int guestId);
 
 		// The backpack is opened. The method takes in as
 		// a parameter a pointer to the Space on which 
 		// the backpack is being used. The method returns
-		// an int value representing the outcome of the
-		// action taken after opening the backpack.
-		int open(Space* curSpace);
+		// the outcome of the action taken after opening the
+		// backpack.
+		BPResult open(const Space* curSpace);
 
 		// Calls the police. This presents the player
-		// with the option to guess who the thief is.
+		// with the option to guess who the thief is (naming
+		// every culprit when there is more than one).
 		// The player can only guess the names of guests
 		// that the player has met. The method has no paramters
-		// and has an int return value. A return value of 0 
+		// and has an int return value. A return value of -1 
 		// indicates that the thief was guessed incorrectly and
-		// a return value of 1 indicates a correct guess.
-		int callPolice() const;
+		// a return value of 1 indicates a correct guess. Once
+		// a guess has been made the police cannot be called
+		// again (0 is returned).
+		int callPolice();
+
+		// Sets the guest ids of the culprits. No return value.
+		void setCulprits(const std::vector<int> &culpritIds);
+
+		// Writes the state of the backpack (the items, whether
+		// the police were called, the contacts and the notes) to
+		// a game snapshot. No return value.
+		void save(SnapshotWriter &out) const;
 
-		// Setter method for the m_thiefName variable.
-		void setThief(std::string thiefName);
+		// Restores the state written by save into an empty 
+		// backpack (the guests must be set first). Returns false
+		// if the snapshot is not valid.
+		bool restore(SnapshotReader &in);
 
 		// Attempts to add an item to the backpack. If
-		// the backpack has extra space, the item is added
-		// and if the backpack does not have extra space,
-		// then the item is not added. A message is output
-		// to the console indicating whether or not the item
-		// was added. The method returns true if the item
-		// is added and false otherwise.
-		bool add(std::string itemType);	
+		// the backpack has extra space (and does not already
+		// hold the item), the item is added and otherwise the
+		// item is not added. A message is output to the 
+		// console indicating whether or not the item was 
+		// added. The method returns true if the item is added
+		// and false otherwise.
+		bool add(ItemId item);	
 };
 
 #endif
@@ -6,23 +6,25 @@
 **				Derived class of the Space class. The class is used
 **				to represent Spaces that hold clues regarding the
 **				identity of the thief (in the context of the 
-**				ThiefGame class). A clue has a text member variable
-**				that holds the content of the clue.
+**				ThiefGame class). A clue has a Message member 
+**				variable that holds the content of the clue.
 *********************************************************************/
 
 #include "Clue.hpp"
 #include <string>
-#include <iostream>
 
 // intitialize the TYPE static constant
 const std::string Clue::TYPE{ "Clue" };
 
 /****************************************************************
-Constructor. Sets the clue text based on the single parameter.
+Constructor. Sets the clue content based on the single parameter,
+which should be a MSG_CLUE_GENDER or MSG_CLUE_LETTER message (or
+MSG_GROUP_GENDER or MSG_GROUP_LETTER for a clue about a group of
+culprits).
 ****************************************************************/
 
-Clue::Clue(std::string clueStr)
-	: m_text{ clueStr }	
+Clue::Clue(const Message &clue)
+	: m_clue(clue)	
 {
 }
 
@@ -48,14 +50,13 @@ std::string Clue::statType()
 }
 
 /****************************************************************
-Prints a single character to the console representing the
-Clue space. The method takes no parameters and has no return 
-value.
+Returns the single character that represents the Clue
+space on the map. The method takes no parameters.
 ****************************************************************/
 
-void Clue::printSpace() const
+char Clue::getSymbol() const
 {
-	std::cout << "C"; 
+	return 'C';
 }
 
 /****************************************************************
@@ -65,19 +66,55 @@ parameters and returns as a string the Clue TYPE.
 
 std::string Clue::event()
 {
-	std::cout << "You pick up a slip of paper that contains "
-		<< "the following note...\n"
-		<< m_text << "\n";
+	say(Message{ MSG_CLUE_FOUND });
+	say(m_clue);
 	return TYPE;
 }
 
 /****************************************************************
-Returns information related to the Clue as a string.
-The information includes the text of the clue. 
+Returns information related to the Clue as a Fact.
+The information is the notepad version of the clue. 
 ****************************************************************/
 
-std::string Clue::information() 
+Fact Clue::information() 
 {
-	std::string infoStr = "Clue: " + m_text;
-	return infoStr;	
+	Fact info;
+	switch (m_clue.id)
+	{
+		case MSG_CLUE_GENDER:
+		{
+			info.kind = FACT_CLUE_GENDER;
+			info.value = m_clue.male;
+			break;
+		}
+		case MSG_GROUP_GENDER:
+		{
+			info.kind = FACT_GROUP_GENDER;
+			info.value = m_clue.male;
+			break;
+		}
+		case MSG_GROUP_LETTER:
+		{
+			info.kind = FACT_GROUP_LETTER;
+			info.value = m_clue.letter;
+			break;
+		}
+		default:
+		{
+			info.kind = FACT_CLUE_LETTER;
+			info.value = m_clue.letter;
+			break;
+		}
+	}
+	return info;	
+}
+
+/****************************************************************
+Returns the message holding the content of the clue. No 
+parameters.
+****************************************************************/
+
+const Message& Clue::getClue() const
+{
+	return m_clue;
 }
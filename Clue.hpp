@@ -6,25 +6,30 @@
 **				Derived class of the Space class. The class is used
 **				to represent Spaces that hold clues regarding the
 **				identity of the thief (in the context of the 
-**				ThiefGame class). A clue has a text member variable
-**				that holds the content of the clue.
+**				ThiefGame class). A clue has a Message member 
+**				variable that holds the content of the clue.
 *********************************************************************/
 
 #ifndef CLUE_HPP
 #define CLUE_HPP
 
 #include "Space.hpp"
+#include "Messages.hpp"
+#include "Fact.hpp"
 #include <string>
 
 class Clue : public Space {
 	private:
-		// string holding the text of the clue
-		std::string m_text;	
+		// message holding the content of the clue (either
+		// MSG_CLUE_GENDER or MSG_CLUE_LETTER, or one of the
+		// MSG_GROUP versions when there is more than one
+		// culprit)
+		Message m_clue;	
 		static const std::string TYPE;
 	public:
-		// Constructor. Sets the clue text based
+		// Constructor. Sets the clue content based
 		// on the single parameter
-		Clue(std::string clueStr);
+		Clue(const Message &clue);
 
 		// Returns a string representing the Clue
 		// type. Used to distinguish Clue spaces 
@@ -37,9 +42,9 @@ class Clue : public Space {
 		// object instance.
 		static std::string statType();
 
-		// Prints a single character to the console
-		// representing the Clue space.
-		virtual void printSpace() const override;
+		// Returns the single character that represents
+		// the Clue space on the map.
+		virtual char getSymbol() const override;
 
 		// Performs an event related to the Clue
 		// and returns a string representing the
@@ -47,8 +52,11 @@ class Clue : public Space {
 		virtual std::string event() override;
 
 		// Returns information related to the Clue
-		// as a string. No parameters.
-		virtual std::string information() override;	
+		// as a Fact. No parameters.
+		virtual Fact information() override;	
+
+		// Returns the message holding the content of the clue.
+		const Message& getClue() const;
 };
 
 #endif
@@ -0,0 +1,361 @@
+/*********************************************************************
+** Program name: Crowd.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the Crowd class.
+**				See Crowd.hpp.
+*********************************************************************/
+
+#include "Crowd.hpp"
+#include <vector>
+#include <cstdlib>
+
+/****************************************************************
+Constructor. The first parameter is the number of rows in the
+room and the second parameter is the number of columns. The
+crowd starts with no guests and only the border blocked.
+****************************************************************/
+
+Crowd::Crowd(int rows, int cols)
+	: m_rows{ rows },
+	  m_cols{ cols },
+	  m_stride{ cols + 2 },
+	  m_stepOffset{ -(cols + 2), 1, cols + 2, -1 },
+	  m_occupant((rows + 2) * (cols + 2), NO_GUEST),
+	  m_flow((rows + 2) * (cols + 2), FLOW_NONE),
+	  m_playerCell{ GONE_CELL },
+	  m_seed{ 1 }
+{
+	// block the border around the room
+	for (int col = 0; col < m_stride; col++)
+	{
+		m_occupant[col] = BLOCKED;
+		m_occupant[(rows + 1) * m_stride + col] = BLOCKED;
+		m_flow[col] = FLOW_STAY;
+		m_flow[(rows + 1) * m_stride + col] = FLOW_STAY;
+	}
+	for (int row = 1; row <= rows; row++)
+	{
+		m_occupant[row * m_stride] = BLOCKED;
+		m_occupant[row * m_stride + cols + 1] = BLOCKED;
+		m_flow[row * m_stride] = FLOW_STAY;
+		m_flow[row * m_stride + cols + 1] = FLOW_STAY;
+	}
+}
+
+/****************************************************************
+Returns the padded cell for the row and column (of the room)
+passed as the parameters.
+****************************************************************/
+
+int Crowd::paddedCell(int row, int col) const
+{
+	return (row + 1) * m_stride + col + 1;
+}
+
+/****************************************************************
+Sets the seed for the random steps of the guests. The seed must
+not be 0 for xorshift, so 0 is changed to 1. No return value.
+****************************************************************/
+
+void Crowd::setSeed(unsigned int seed)
+{
+	m_seed = seed != 0 ? seed : 1;
+}
+
+/****************************************************************
+Returns the state of the xorshift generator. Passing it to setSeed
+carries on the random steps from the same point (ex. in a saved 
+game).
+****************************************************************/
+
+unsigned int Crowd::getSeed() const
+{
+	return m_seed;
+}
+
+/****************************************************************
+Returns the next number from the xorshift generator. Used rather
+than rand so a step for a large crowd stays cheap.
+****************************************************************/
+
+unsigned int Crowd::nextRand()
+{
+	m_seed ^= m_seed << 13;
+	m_seed ^= m_seed >> 17;
+	m_seed ^= m_seed << 5;
+	return m_seed;
+}
+
+/****************************************************************
+Adds a guest to the crowd. The first parameter is the guest id
+and the other parameters are the row and column of the guest's
+cell. No return value.
+****************************************************************/
+
+void Crowd::add(int guestId, int row, int col)
+{
+	if (guestId >= static_cast<int>(m_cell.size()))
+	{
+		m_cell.resize(guestId + 1, GONE_CELL);
+		m_roomCell.resize(guestId + 1, 0);
+		m_target.resize(guestId + 1, GONE_CELL);
+		m_pinned.resize(guestId + 1, 0);
+	}
+
+	int cell = paddedCell(row, col);
+	m_cell[guestId] = cell;
+	m_roomCell[guestId] = row * m_cols + col;
+	m_target[guestId] = cell;
+	m_occupant[cell] = guestId;
+}
+
+/****************************************************************
+Removes a guest from the crowd. The single parameter is the
+guest id. The guest is put in the GONE_CELL, where it never
+steps. Does nothing if the guest is not in the crowd. No return
+value.
+****************************************************************/
+
+void Crowd::remove(int guestId)
+{
+	if (guestId < 0 || guestId >= static_cast<int>(m_cell.size())
+		|| m_cell[guestId] == GONE_CELL)
+	{
+		return;
+	}
+
+	m_occupant[m_cell[guestId]] = NO_GUEST;
+	m_cell[guestId] = GONE_CELL;
+	m_target[guestId] = GONE_CELL;
+}
+
+/****************************************************************
+Sets whether a guest is steered from outside the crowd. A pinned
+guest never steps on its own and is moved with moveTo. The first
+parameter is the guest id and the second is true to pin the
+guest. No return value.
+****************************************************************/
+
+void Crowd::setPinned(int guestId, bool pinned)
+{
+	m_pinned[guestId] = pinned;
+}
+
+/****************************************************************
+Moves a guest to a free cell. The first parameter is the guest
+id and the other parameters are the row and column of the cell.
+No return value.
+****************************************************************/
+
+void Crowd::moveTo(int guestId, int row, int col)
+{
+	int cell = paddedCell(row, col);
+	m_occupant[m_cell[guestId]] = NO_GUEST;
+	m_occupant[cell] = guestId;
+	m_cell[guestId] = cell;
+	m_roomCell[guestId] = row * m_cols + col;
+	m_target[guestId] = cell;
+}
+
+/****************************************************************
+Sets whether guests may step onto a cell. The first two
+parameters are the row and column of the cell and the last
+parameter is true if the cell is blocked. A cell with a guest
+in it is left as it is. No return value.
+****************************************************************/
+
+void Crowd::setBlocked(int row, int col, bool blocked)
+{
+	int cell = paddedCell(row, col);
+	if (m_occupant[cell] < 0)
+	{
+		m_occupant[cell] = blocked ? BLOCKED : NO_GUEST;
+	}
+}
+
+/****************************************************************
+Sets the cell that guests gather around and works out the step
+towards it from every cell of the room: along the direction in
+which the cell is furthest away. Cells near it are marked as the
+dance floor. The parameters are the row and column of the cell.
+No return value.
+****************************************************************/
+
+void Crowd::setAttractor(int row, int col)
+{
+	for (int r = 0; r < m_rows; r++)
+	{
+		for (int c = 0; c < m_cols; c++)
+		{
+			int toRow = row - r;
+			int toCol = col - c;
+			unsigned char flow;
+			if (std::abs(toRow) <= DANCE_RADIUS 
+				&& std::abs(toCol) <= DANCE_RADIUS)
+			{
+				flow = FLOW_DANCE;
+			}
+			else if (std::abs(toRow) > std::abs(toCol))
+			{
+				flow = toRow < 0 ? 0 : 2;
+			}
+			else
+			{
+				flow = toCol > 0 ? 1 : 3;
+			}
+			m_flow[paddedCell(r, c)] = flow;
+		}
+	}
+}
+
+/****************************************************************
+Moves the crowd on by a minute. The first two parameters are the
+row and column of the player and the guests that moved are
+placed in the last parameter (which is cleared first).
+The step of every guest is chosen first, from the flow towards
+the stereo and a random number (without branches, so the loop
+stays fast for a very large crowd):
+- guests far from the stereo step towards it half of the time
+- guests near the stereo dance, stepping at random now and then
+- otherwise (no stereo) guests step at random now and then
+The guests around the player are then looked at on their own:
+the guest the player is on is held (being talked to) and stays,
+and the others step away from the player. Pinned guests never
+step.
+The steps are then resolved in a single pass over the guests that
+want to step: a guest only moves if the cell it wants is free,
+so guests that want the same cell are settled in the order they
+were listed. No return value.
+****************************************************************/
+
+void Crowd::step(int playerRow, int playerCol, std::vector<Move> &moves)
+{
+	// for each flow value, the bits of the random number that must
+	// all be 0 for the guest to step (half of the time towards the
+	// stereo, a quarter of the time otherwise)
+	static constexpr unsigned int STEP_BITS[] = { 1, 1, 1, 1, 3, 3, 3 };
+
+	int numGuests = m_cell.size();
+	m_stepping.resize(numGuests + (2 * AVOID_RADIUS + 1) 
+		* (2 * AVOID_RADIUS + 1));
+	int numStepping = 0;
+
+	// choose a step for every guest. Each guest needs 4 random
+	// bits, so one random number serves 8 guests.
+	unsigned int bits = 0;
+	for (int id = 0; id < numGuests; id++)
+	{
+		if ((id & 7) == 0)
+		{
+			bits = nextRand();
+		}
+		unsigned int roll = bits;
+		bits >>= 4;
+		int cell = m_cell[id];
+		unsigned int flow = m_flow[cell];
+		unsigned int dir = flow < FLOW_DANCE ? flow : (roll >> 2) & 3;
+		int stepping = ((roll & STEP_BITS[flow]) == 0) 
+			& (flow != FLOW_STAY) & !m_pinned[id];
+		m_target[id] = cell + (m_stepOffset[dir] & -stepping);
+		m_stepping[numStepping] = id;
+		numStepping += stepping;
+	}
+
+	// guests close to the player step away from the player instead
+	m_playerCell = paddedCell(playerRow, playerCol);
+	for (int r = playerRow - AVOID_RADIUS; r <= playerRow + AVOID_RADIUS; 
+		r++)
+	{
+		for (int c = playerCol - AVOID_RADIUS; 
+			c <= playerCol + AVOID_RADIUS; c++)
+		{
+			if (r < 0 || r >= m_rows || c < 0 || c >= m_cols)
+			{
+				continue;
+			}
+			int id = m_occupant[paddedCell(r, c)];
+			if (id < 0 || m_pinned[id])
+			{
+				continue;
+			}
+			if (r == playerRow && c == playerCol)
+			{
+				m_target[id] = m_cell[id];
+				continue;
+			}
+
+			// step along the direction the player is furthest
+			// away in
+			unsigned int roll = nextRand();
+			int fromRow = r - playerRow;
+			int fromCol = c - playerCol;
+			int randSign = (roll & 2) ? 1 : -1;
+			int stepRow = 0;
+			int stepCol = 0;
+			if (std::abs(fromRow) > std::abs(fromCol)
+				|| (std::abs(fromRow) == std::abs(fromCol) && (roll & 1)))
+			{
+				stepRow = fromRow > 0 ? 1 : fromRow < 0 ? -1 : randSign;
+			}
+			else
+			{
+				stepCol = fromCol > 0 ? 1 : fromCol < 0 ? -1 : randSign;
+			}
+			m_target[id] = m_cell[id] + stepRow * m_stride + stepCol;
+			// the guest may already be listed, in which case it is
+			// simply looked at twice
+			m_stepping[numStepping++] = id;
+		}
+	}
+
+	// move every guest whose target cell is free
+	moves.clear();
+	for (int i = 0; i < numStepping; i++)
+	{
+		int id = m_stepping[i];
+		int fromCell = m_cell[id];
+		int toCell = m_target[id];
+		if (toCell == fromCell || toCell == m_playerCell
+			|| m_occupant[toCell] != NO_GUEST)
+		{
+			continue;
+		}
+
+		// a step of a row in the padded room is a step of a row
+		// in the room, which is narrower
+		int step = toCell - fromCell;
+		int roomStep = step == m_stride ? m_cols 
+			: step == -m_stride ? -m_cols : step;
+		int fromRoomCell = m_roomCell[id];
+
+		m_occupant[fromCell] = NO_GUEST;
+		m_occupant[toCell] = id;
+		m_cell[id] = toCell;
+		m_roomCell[id] = fromRoomCell + roomStep;
+		moves.push_back(Move{ id, fromRoomCell, fromRoomCell + roomStep });
+	}
+}
+
+/****************************************************************
+Returns the state of the guest whose id is the single parameter,
+as of the last minute.
+****************************************************************/
+
+Crowd::GuestState Crowd::getState(int guestId) const
+{
+	if (guestId < 0 || guestId >= static_cast<int>(m_cell.size())
+		|| m_cell[guestId] == GONE_CELL)
+	{
+		return GONE;
+	}
+	if (m_cell[guestId] == m_playerCell)
+	{
+		return HELD;
+	}
+	if (m_flow[m_cell[guestId]] == FLOW_DANCE)
+	{
+		return DANCING;
+	}
+	return WANDERING;
+}
@@ -0,0 +1,162 @@
+/*********************************************************************
+** Program name: Crowd.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the Crowd class.
+**				Used with the ThiefGame class to move the party guests
+**				around the room when guests are set to wander (see
+**				GameOptions). Every game minute each guest decides
+**				on a step: away from the player if the player is
+**				close, towards the stereo if it is far away, or a
+**				random step now and then. All of the steps are
+**				chosen first and then resolved in a single pass, so
+**				two guests never end up in the same cell.
+**				The guests are held as a structure of arrays (cells,
+**				targets and states in separate arrays, indexed by
+**				guest id). The room is held as flat arrays with a
+**				blocked border around it, so steps never need bounds
+**				checks, and the step towards the stereo from every
+**				cell is worked out once when the stereo is placed.
+**				A minute of a very large crowd is then a couple of
+**				tight loops over flat arrays, with only the guests
+**				around the player looked at on their own.
+*********************************************************************/
+
+#ifndef CROWD_HPP
+#define CROWD_HPP
+
+#include <vector>
+
+class Crowd {
+	public:
+		// what a guest is doing
+		enum GuestState : unsigned char {
+			GONE = 0,
+			WANDERING,
+			DANCING,
+			HELD
+		};
+
+		// a guest that moved in the last minute: the guest id
+		// and the cells (as row * cols + col) moved from and to
+		struct Move {
+			int guestId;
+			int fromCell;
+			int toCell;
+		};
+
+		// Constructor. The parameters are the number of rows
+		// and columns in the room.
+		Crowd(int rows, int cols);
+
+		// Sets the seed for the random steps. No return value.
+		void setSeed(unsigned int seed);
+
+		// Returns the state of the random steps, which can be
+		// passed to setSeed to carry on from the same point.
+		unsigned int getSeed() const;
+
+		// Adds the guest whose id is the first parameter to the
+		// cell at the given row and column. No return value.
+		void add(int guestId, int row, int col);
+
+		// Removes the guest whose id is the single parameter.
+		// No return value.
+		void remove(int guestId);
+
+		// Sets whether the guest whose id is the first parameter
+		// is steered from outside the crowd (true) rather than
+		// stepping on its own. No return value.
+		void setPinned(int guestId, bool pinned);
+
+		// Moves the guest whose id is the first parameter to the
+		// free cell at the given row and column. Used for guests
+		// steered from outside the crowd. No return value.
+		void moveTo(int guestId, int row, int col);
+
+		// Sets whether guests may step onto the cell at the
+		// given row and column (ex. clues and item boxes block
+		// guests). No return value.
+		void setBlocked(int row, int col, bool blocked);
+
+		// Sets the cell guests gather around (the stereo). No
+		// return value.
+		void setAttractor(int row, int col);
+
+		// Moves the crowd on by a minute. The first two
+		// parameters are the row and column of the player. The
+		// guests that moved are placed in the last parameter. No
+		// return value.
+		void step(int playerRow, int playerCol, std::vector<Move> &moves);
+
+		// Returns the state of the guest whose id is the single
+		// parameter, as of the last minute.
+		GuestState getState(int guestId) const;
+
+	private:
+		// guests this many steps (or fewer) from the player step
+		// away from the player
+		static constexpr int AVOID_RADIUS = 2;
+		// guests this many steps (or fewer) from the stereo are
+		// dancing and stay close to it
+		static constexpr int DANCE_RADIUS = 2;
+
+		// held in a cell in place of a guest id when the cell is
+		// free or blocked
+		static constexpr int NO_GUEST = -1;
+		static constexpr int BLOCKED = -2;
+
+		// held in a cell in place of the direction towards the
+		// stereo when the cell is near the stereo, when there is
+		// no stereo, or when the cell is on the border (guests
+		// there never step)
+		static constexpr unsigned char FLOW_DANCE = 4;
+		static constexpr unsigned char FLOW_NONE = 5;
+		static constexpr unsigned char FLOW_STAY = 6;
+
+		// the padded cell that guests who have left are put in.
+		// It is a corner of the border, so they never step.
+		static constexpr int GONE_CELL = 0;
+
+		// the size of the room, and the width of a row of the
+		// padded room (the room plus a blocked border)
+		int m_rows;
+		int m_cols;
+		int m_stride;
+
+		// the change in padded cell of a step in each direction
+		// (up, right, down, left)
+		int m_stepOffset[4];
+
+		// the guests, indexed by guest id: the padded cell the
+		// guest is in, the same cell in the room (as row * cols
+		// + col) and the padded cell it wants to step to
+		std::vector<int> m_cell;
+		std::vector<int> m_roomCell;
+		std::vector<int> m_target;
+		// 1 for the guests steered from outside the crowd
+		std::vector<unsigned char> m_pinned;
+
+		// the guests that want to step in the current minute
+		std::vector<int> m_stepping;
+
+		// for each padded cell: the guest in it (or NO_GUEST /
+		// BLOCKED) and the direction towards the stereo (or
+		// one of the FLOW values)
+		std::vector<int> m_occupant;
+		std::vector<unsigned char> m_flow;
+
+		// the padded cell of the player in the last minute
+		int m_playerCell;
+
+		// state of the random number generator (xorshift)
+		unsigned int m_seed;
+
+		// returns the padded cell for the given row and column
+		int paddedCell(int row, int col) const;
+
+		// returns the next random number
+		unsigned int nextRand();
+};
+
+#endif
@@ -0,0 +1,372 @@
+/*********************************************************************
+** Program name: CulpritSolver.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the CulpritSolver class.
+**				See CulpritSolver.hpp.
+*********************************************************************/
+
+#include "CulpritSolver.hpp"
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <bitset>
+#include <cstdint>
+#include "Fact.hpp"
+#include "GuestTable.hpp"
+
+/****************************************************************
+Constructor. The solver starts with a single culprit and no
+suspects, so no set fits until it is set up.
+****************************************************************/
+
+CulpritSolver::CulpritSolver()
+	: m_numCulprits{ 1 },
+	  m_clues{ 0 },
+	  m_admittedClues{ 0 },
+	  m_impossible{ true },
+	  m_chosen{},
+	  m_mode{ FIND_SETS },
+	  m_maxSets{ 0 },
+	  m_numFound{ 0 },
+	  m_sets{ nullptr },
+	  m_numPossible{ 0 },
+	  m_numCertain{ 0 }
+{
+}
+
+/****************************************************************
+Returns the bits of the clues that a guest fits: the bit for their
+gender and the bit for each letter in their name (the letter bits
+of the guest table, moved up past the gender bits). The first
+parameter holds the guests and the second is the guest id.
+****************************************************************/
+
+unsigned int CulpritSolver::clueBits(const GuestTable &guests, 
+	int guestId)
+{
+	return (guests.isMale(guestId) ? MALE_CLUE : FEMALE_CLUE)
+		| (guests.getLetters(guestId) << FIRST_LETTER_BIT);
+}
+
+/****************************************************************
+Sets up the solver from the notes. The first parameter holds the
+guests of the party (indexed by guest id), the second the notes
+taken, the third the guest ids of the suspects and the last the
+number of culprits. The clues are turned into bits, the guests
+that admitted to the theft are set aside (they are in every set)
+and the guests that denied it or left the party are dropped. The
+rest of the suspects make up the pool the sets are searched in,
+with the suspects that fit the most clues first. When a single
+culprit is left to find (always the case with one culprit), that
+guest must fit every clue the admitted guests don't, so the pool
+is found by ANDing the suspects with the guest bitsets of those
+clues. No return value.
+****************************************************************/
+
+void CulpritSolver::setUp(const GuestTable &guests,
+	const std::vector<Fact> &notes, const std::vector<int> &suspects,
+	int numCulprits)
+{
+	m_numCulprits = std::min(numCulprits, MAX_CULPRITS);
+	m_clues = 0;
+	m_admitted.clear();
+	m_admittedClues = 0;
+
+	// 1 for guests that can't be culprits, 2 for guests that
+	// admitted to the theft
+	static constexpr char RULED_OUT{ 1 };
+	static constexpr char ADMITTED{ 2 };
+	std::vector<char> status(guests.size(), 0);
+	for (const Fact &note : notes)
+	{
+		switch (note.kind)
+		{
+			case FACT_CLUE_GENDER:
+			case FACT_GROUP_GENDER:
+			{
+				m_clues |= note.value != 0 ? MALE_CLUE : FEMALE_CLUE;
+				break;
+			}
+			case FACT_CLUE_LETTER:
+			case FACT_GROUP_LETTER:
+			{
+				m_clues |= GuestTable::letterBit(note.value) 
+					<< FIRST_LETTER_BIT;
+				break;
+			}
+			case FACT_TRUTH:
+			{
+				if (note.value != 0 && status[note.guest] != ADMITTED)
+				{
+					status[note.guest] = ADMITTED;
+					m_admitted.push_back(note.guest);
+					m_admittedClues |= clueBits(guests, note.guest);
+				}
+				else if (note.value == 0)
+				{
+					status[note.guest] = RULED_OUT;
+				}
+				break;
+			}
+			case FACT_GUEST_LEFT:
+			{
+				// culprits never leave the party early
+				if (note.guest != Fact::NO_GUEST)
+				{
+					status[note.guest] = RULED_OUT;
+				}
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+	}
+
+	// the pool holds every other suspect, once, with the suspects
+	// that fit the most clues first
+	std::vector<int> pool;
+	std::vector<unsigned int> poolClues;
+	int numLeft = m_numCulprits - static_cast<int>(m_admitted.size());
+	if (numLeft == 1)
+	{
+		unsigned int needed = m_clues & ~m_admittedClues;
+		std::vector<std::uint64_t> fitting(guests.numWords(), 0);
+		for (int guestId : suspects)
+		{
+			if (status[guestId] == 0)
+			{
+				fitting[guestId / GuestTable::SET_BITS] |= 
+					std::uint64_t{ 1 } << (guestId % GuestTable::SET_BITS);
+			}
+		}
+		guests.keepLetters(needed >> FIRST_LETTER_BIT, fitting);
+		for (int word = 0; word < static_cast<int>(fitting.size()); word++)
+		{
+			if (needed & MALE_CLUE)
+			{
+				fitting[word] &= guests.withGender(true)[word];
+			}
+			if (needed & FEMALE_CLUE)
+			{
+				fitting[word] &= guests.withGender(false)[word];
+			}
+
+			std::uint64_t bits = fitting[word];
+			for (int bit = 0; bits != 0; bit++, bits >>= 1)
+			{
+				if (bits & 1)
+				{
+					int guestId = word * GuestTable::SET_BITS + bit;
+					pool.push_back(guestId);
+					poolClues.push_back(clueBits(guests, guestId) & m_clues);
+				}
+			}
+		}
+	}
+	else
+	{
+		for (int guestId : suspects)
+		{
+			if (status[guestId] == 0)
+			{
+				status[guestId] = RULED_OUT;
+				pool.push_back(guestId);
+				poolClues.push_back(clueBits(guests, guestId) & m_clues);
+			}
+		}
+	}
+	int poolSize = pool.size();
+	std::vector<int> order(poolSize);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(),
+		[&poolClues](int first, int second)
+		{
+			return std::bitset<32>(poolClues[first]).count()
+				> std::bitset<32>(poolClues[second]).count();
+		});
+
+	m_pool.resize(poolSize);
+	m_poolClues.resize(poolSize);
+	m_restClues.assign(poolSize + 1, 0);
+	for (int i = 0; i < poolSize; i++)
+	{
+		m_pool[i] = pool[order[i]];
+		m_poolClues[i] = poolClues[order[i]];
+	}
+	for (int i = poolSize - 1; i >= 0; i--)
+	{
+		m_restClues[i] = m_restClues[i + 1] | m_poolClues[i];
+	}
+
+	m_impossible = static_cast<int>(m_admitted.size()) > m_numCulprits;
+}
+
+/****************************************************************
+Finds the sets of suspects that fit the notes. The first parameter
+is the most sets to find and the sets are added to the last
+parameter, the number of culprits at a time (the admitted guests
+first). The search stops once enough sets are found. Returns the
+number of sets found.
+****************************************************************/
+
+int CulpritSolver::findSets(int maxSets, std::vector<int> &sets)
+{
+	m_mode = FIND_SETS;
+	m_maxSets = maxSets;
+	m_numFound = 0;
+	m_sets = &sets;
+	if (!m_impossible && maxSets > 0)
+	{
+		search(0, 0, m_admittedClues & m_clues);
+	}
+	return m_numFound;
+}
+
+/****************************************************************
+Finds the suspects that are in some set that fits the notes (the
+first parameter) and those in every such set (the second
+parameter). The suspects are tracked as bitsets over the pool,
+and the search stops early once every suspect in the pool is in
+some set and none is in every set, as later sets can't change
+either list. Returns false if no set fits the notes.
+****************************************************************/
+
+bool CulpritSolver::narrow(std::vector<int> &possible,
+	std::vector<int> &certain)
+{
+	possible.clear();
+	certain.clear();
+
+	int numWords = (m_pool.size() + WORD_BITS - 1) / WORD_BITS;
+	m_possible.assign(numWords, 0);
+	m_certain.assign(numWords, ~0ull);
+	m_found.assign(numWords, 0);
+	m_numPossible = 0;
+	m_numCertain = m_pool.size();
+
+	m_mode = NARROW;
+	m_numFound = 0;
+	if (!m_impossible)
+	{
+		search(0, 0, m_admittedClues & m_clues);
+	}
+	if (m_numFound == 0)
+	{
+		return false;
+	}
+
+	possible = m_admitted;
+	certain = m_admitted;
+	for (int i = 0; i < static_cast<int>(m_pool.size()); i++)
+	{
+		unsigned long long bit = 1ull << (i % WORD_BITS);
+		if (m_possible[i / WORD_BITS] & bit)
+		{
+			possible.push_back(m_pool[i]);
+		}
+		if (m_certain[i / WORD_BITS] & bit)
+		{
+			certain.push_back(m_pool[i]);
+		}
+	}
+	return true;
+}
+
+/****************************************************************
+Searches the sets made by adding guests from the pool, in pool
+order so each set is only made once. The first parameter is the
+position in the pool to carry on from, the second the number of
+guests chosen so far and the last the clue bits covered by the
+guests so far. A branch is dropped if there are too few guests
+left in the pool to fill the set, or if the guests left can't
+cover the clues still missing. Returns false once the search can
+stop.
+****************************************************************/
+
+bool CulpritSolver::search(int from, int numChosen, unsigned int covered)
+{
+	int numLeft = m_numCulprits - static_cast<int>(m_admitted.size())
+		- numChosen;
+	if (numLeft == 0)
+	{
+		return covered != m_clues || foundSet();
+	}
+	if (static_cast<int>(m_pool.size()) - from < numLeft
+		|| (covered | m_restClues[from]) != m_clues)
+	{
+		return true;
+	}
+
+	for (int i = from; i <= static_cast<int>(m_pool.size()) - numLeft; i++)
+	{
+		// once the guests after this one can't cover what is
+		// missing without it, no later choice can either
+		if ((covered | m_restClues[i]) != m_clues)
+		{
+			break;
+		}
+		m_chosen[numChosen] = i;
+		if (!search(i + 1, numChosen + 1, covered | m_poolClues[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/****************************************************************
+Handles a set that fits the notes: the admitted guests and the
+guests chosen from the pool. When finding sets the set is added
+to the list, and when narrowing the suspects the bitsets are
+updated. Returns false once the search can stop: enough sets have
+been found, or (when narrowing) nothing more can be learned.
+****************************************************************/
+
+bool CulpritSolver::foundSet()
+{
+	int numChosen = m_numCulprits - static_cast<int>(m_admitted.size());
+	m_numFound++;
+
+	if (m_mode == FIND_SETS)
+	{
+		m_sets->insert(m_sets->end(), m_admitted.begin(), m_admitted.end());
+		for (int i = 0; i < numChosen; i++)
+		{
+			m_sets->push_back(m_pool[m_chosen[i]]);
+		}
+		return m_numFound < m_maxSets;
+	}
+
+	for (int i = 0; i < numChosen; i++)
+	{
+		int word = m_chosen[i] / WORD_BITS;
+		unsigned long long bit = 1ull << (m_chosen[i] % WORD_BITS);
+		m_found[word] |= bit;
+		if (!(m_possible[word] & bit))
+		{
+			m_possible[word] |= bit;
+			m_numPossible++;
+		}
+	}
+
+	// only the guests of this set can stay in every set
+	if (m_numCertain > 0)
+	{
+		m_numCertain = 0;
+		for (int word = 0; word < static_cast<int>(m_certain.size()); word++)
+		{
+			m_certain[word] &= m_found[word];
+			m_numCertain += std::bitset<WORD_BITS>(m_certain[word]).count();
+		}
+	}
+	for (int i = 0; i < numChosen; i++)
+	{
+		m_found[m_chosen[i] / WORD_BITS] = 0;
+	}
+
+	return m_numPossible < static_cast<int>(m_pool.size())
+		|| m_numCertain > 0;
+}
@@ -0,0 +1,137 @@
+/*********************************************************************
+** Program name: CulpritSolver.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the CulpritSolver class.
+**				Works out who could have stolen the wallet from the
+**				notes in the notepad. A game may have more than one
+**				culprit (see GameOptions), in which case the clues
+**				describe the group ("one of the culprits is male")
+**				and the answer is a set of guests: every clue must
+**				fit at least one guest of the set. The solver finds
+**				the sets of suspects that fit the notes, or just the
+**				suspects that are in some set and those in every set
+**				(used for hints and by bots).
+**				Each clue is a single bit: one for each gender and
+**				one for each letter. Each suspect is held as the
+**				bits of the clues they fit, so a set fits the notes
+**				when the bits of its guests together cover the bits
+**				of the clues. The sets are searched one guest at a
+**				time, and a branch is dropped as soon as the guests
+**				left can't cover the clues still missing (or there
+**				are too few of them). Guests that admitted to the
+**				theft are in every set, and guests that denied it
+**				or left early are never in one. When only one
+**				culprit is left to find, the suspects that fit the
+**				clues are found at once from the guest bitsets of
+**				the clues (see GuestTable).
+*********************************************************************/
+
+#ifndef CULPRITSOLVER_HPP
+#define CULPRITSOLVER_HPP
+
+#include <vector>
+#include "Fact.hpp"
+#include "GuestTable.hpp"
+
+class CulpritSolver {
+	public:
+		// the most culprits a game may have
+		static constexpr int MAX_CULPRITS = 3;
+
+		// Constructor. The solver starts with no suspects.
+		CulpritSolver();
+
+		// Sets up the solver. The first parameter holds the
+		// guests of the party (indexed by guest id), the second
+		// the notes taken, the third the guest ids of the
+		// suspects (ex. the guests the player has met) and the
+		// last parameter is the number of culprits. No return
+		// value.
+		void setUp(const GuestTable &guests,
+			const std::vector<Fact> &notes,
+			const std::vector<int> &suspects, int numCulprits);
+
+		// Finds the sets of suspects that fit the notes, up to the
+		// number given as the first parameter. Each set is added
+		// to the last parameter as the guest ids of its culprits
+		// (the number of culprits at a time). Returns the number
+		// of sets found.
+		int findSets(int maxSets, std::vector<int> &sets);
+
+		// Finds the suspects that are in at least one set that
+		// fits the notes (first parameter) and the suspects that
+		// are in every such set (second parameter), as guest ids.
+		// Returns false if no set fits the notes.
+		bool narrow(std::vector<int> &possible, std::vector<int> &certain);
+
+	private:
+		// the bits of the clues: one for each gender and one for
+		// each letter of the alphabet
+		static constexpr unsigned int MALE_CLUE = 1u << 0;
+		static constexpr unsigned int FEMALE_CLUE = 1u << 1;
+		static constexpr int FIRST_LETTER_BIT = 2;
+
+		// the number of bits in a word of the suspect bitsets
+		static constexpr int WORD_BITS = 64;
+
+		// what the search is doing with the sets it finds
+		enum SearchMode { FIND_SETS, NARROW };
+
+		int m_numCulprits;
+
+		// the bits of every clue in the notes
+		unsigned int m_clues;
+
+		// the guests that admitted to the theft, and the bits of
+		// the clues they fit between them
+		std::vector<int> m_admitted;
+		unsigned int m_admittedClues;
+
+		// the suspects that may still be culprits (other than the
+		// admitted guests), the bits of the clues each of them
+		// fits and the bits fit by each suspect onwards (so the
+		// search knows what the rest of the suspects can cover)
+		std::vector<int> m_pool;
+		std::vector<unsigned int> m_poolClues;
+		std::vector<unsigned int> m_restClues;
+
+		// true if no set can fit the notes (ex. more guests
+		// admitted than there are culprits)
+		bool m_impossible;
+
+		// the state of the search: the positions in the pool of
+		// the guests chosen so far, and what to do with each set
+		// found
+		int m_chosen[MAX_CULPRITS];
+		SearchMode m_mode;
+		int m_maxSets;
+		int m_numFound;
+		std::vector<int>* m_sets;
+		// bitsets over the pool of the suspects in some set found,
+		// in every set found and in the set just found, along with
+		// the number of suspects in the first two
+		std::vector<unsigned long long> m_possible;
+		std::vector<unsigned long long> m_certain;
+		std::vector<unsigned long long> m_found;
+		int m_numPossible;
+		int m_numCertain;
+
+		// returns the bits of the clues the guest (second
+		// parameter) fits
+		static unsigned int clueBits(const GuestTable &guests, 
+			int guestId);
+
+		// searches the sets made by adding guests from the given
+		// position of the pool onwards. The parameters are the
+		// position, the number of guests chosen and the clue bits
+		// covered so far. Returns false once the search can stop.
+		bool search(int from, int numChosen, unsigned int covered);
+
+		// handles a set found by the search (the admitted guests
+		// and the chosen guests). Returns false once the search
+		// can stop.
+		bool foundSet();
+};
+
+#endif
@@ -0,0 +1,261 @@
+/*********************************************************************
+** Program name: DistanceField.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the DistanceField class.
+**				See DistanceField.hpp.
+*********************************************************************/
+
+#include "DistanceField.hpp"
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+/****************************************************************
+Constructor. The first parameter is the number of rows in the
+room, the second parameter is the number of columns and the last
+parameter is the horizon. Only the border around the room is 
+blocked. The field is worked out when the source is first set.
+****************************************************************/
+
+DistanceField::DistanceField(int rows, int cols, int horizon)
+	: m_rows{ rows },
+	  m_cols{ cols },
+	  m_stride{ cols + 2 },
+	  m_far{ horizon + 1 },
+	  m_stepOffset{ -(cols + 2), 1, cols + 2, -1 },
+	  m_dist((rows + 2) * (cols + 2), horizon + 1),
+	  m_blocked((rows + 2) * (cols + 2), 0),
+	  m_source{ NO_CELL },
+	  m_stale{ true },
+	  m_queue((rows + 2) * (cols + 2)),
+	  m_queuedIn((rows + 2) * (cols + 2), 0),
+	  m_update{ 0 }
+{
+	// block the border around the room
+	for (int col = 0; col < m_stride; col++)
+	{
+		m_blocked[col] = 1;
+		m_blocked[(rows + 1) * m_stride + col] = 1;
+	}
+	for (int row = 1; row <= rows; row++)
+	{
+		m_blocked[row * m_stride] = 1;
+		m_blocked[row * m_stride + cols + 1] = 1;
+	}
+}
+
+/****************************************************************
+Returns the padded cell for the row and column (of the room)
+passed as the parameters.
+****************************************************************/
+
+int DistanceField::paddedCell(int row, int col) const
+{
+	return (row + 1) * m_stride + col + 1;
+}
+
+/****************************************************************
+Returns true if a path may pass through the padded cell passed
+as the parameter: the cell is not blocked, or the source is on
+it.
+****************************************************************/
+
+bool DistanceField::passable(int cell) const
+{
+	return !m_blocked[cell] || cell == m_source;
+}
+
+/****************************************************************
+Sets whether a cell is blocked. The first two parameters are the
+row and column of the cell and the last parameter is true if the
+cell is blocked. A change means the field is worked out in full
+the next time the source is set. No return value.
+****************************************************************/
+
+void DistanceField::setBlocked(int row, int col, bool blocked)
+{
+	int cell = paddedCell(row, col);
+	if (static_cast<bool>(m_blocked[cell]) != blocked)
+	{
+		m_blocked[cell] = blocked;
+		m_stale = true;
+	}
+}
+
+/****************************************************************
+Moves the source to a new cell and brings the field up to date.
+The parameters are the row and column of the new cell. If the
+source moved to an adjacent cell (and neither cell is blocked)
+the field is updated, otherwise it is worked out in full. No
+return value.
+****************************************************************/
+
+void DistanceField::setSource(int row, int col)
+{
+	int cell = paddedCell(row, col);
+	if (cell == m_source && !m_stale)
+	{
+		return;
+	}
+
+	int step = std::abs(cell - m_source);
+	if (m_stale || m_source == NO_CELL
+		|| (step != 1 && step != m_stride)
+		|| m_blocked[cell] || m_blocked[m_source])
+	{
+		m_source = cell;
+		recompute();
+		m_stale = false;
+		return;
+	}
+
+	int oldSource = m_source;
+	m_source = cell;
+	lowerFrom(cell);
+	raiseFrom(oldSource);
+}
+
+/****************************************************************
+Returns the number of steps from the source to the cell at the
+given row and column, or the far distance if the cell is beyond
+the horizon or can't be reached.
+****************************************************************/
+
+int DistanceField::distance(int row, int col) const
+{
+	return m_dist[paddedCell(row, col)];
+}
+
+/****************************************************************
+Returns the distance given to cells beyond the horizon.
+****************************************************************/
+
+int DistanceField::getFar() const
+{
+	return m_far;
+}
+
+/****************************************************************
+Works out the field in full with a breadth first search from the
+source, out to the horizon. No parameters and no return value.
+****************************************************************/
+
+void DistanceField::recompute()
+{
+	std::fill(m_dist.begin(), m_dist.end(), m_far);
+	m_dist[m_source] = 0;
+
+	int head = 0;
+	int tail = 0;
+	m_queue[tail++] = m_source;
+	while (head < tail)
+	{
+		int cell = m_queue[head++];
+		int nextDist = m_dist[cell] + 1;
+		if (nextDist == m_far)
+		{
+			continue;
+		}
+		for (int offset : m_stepOffset)
+		{
+			int next = cell + offset;
+			if (!m_blocked[next] && m_dist[next] == m_far)
+			{
+				m_dist[next] = nextDist;
+				m_queue[tail++] = next;
+			}
+		}
+	}
+}
+
+/****************************************************************
+First wave of an update: a breadth first search from the new
+source that only goes on through cells that are now closer to
+the source than before. Since the search is in order of the new
+distances, each cell is lowered at most once, and the search
+stops at the horizon. The single parameter is the new source. No
+return value.
+****************************************************************/
+
+void DistanceField::lowerFrom(int newSource)
+{
+	m_dist[newSource] = 0;
+
+	int head = 0;
+	int tail = 0;
+	m_queue[tail++] = newSource;
+	while (head < tail)
+	{
+		int cell = m_queue[head++];
+		int nextDist = m_dist[cell] + 1;
+		for (int offset : m_stepOffset)
+		{
+			int next = cell + offset;
+			if (!m_blocked[next] && nextDist < m_dist[next])
+			{
+				m_dist[next] = nextDist;
+				m_queue[tail++] = next;
+			}
+		}
+	}
+}
+
+/****************************************************************
+Second wave of an update: a cell is still right if one of its
+neighbours is a step closer to the source. Starting from the old
+source, every cell without such a neighbour is raised by one, and
+the neighbours that were a step further away from it are checked
+in turn. The cells are checked in order of their old distance, so
+a cell is only checked once all of the cells that could hold its
+shortest path have been. Cells beyond the horizon stay there. The
+single parameter is the old source. No return value.
+****************************************************************/
+
+void DistanceField::raiseFrom(int oldSource)
+{
+	m_update++;
+	int head = 0;
+	int tail = 0;
+	m_queue[tail++] = oldSource;
+	m_queuedIn[oldSource] = m_update;
+	while (head < tail)
+	{
+		int cell = m_queue[head++];
+		if (m_dist[cell] >= m_far)
+		{
+			continue;
+		}
+		int wanted = m_dist[cell] - 1;
+		bool supported = false;
+		for (int offset : m_stepOffset)
+		{
+			int next = cell + offset;
+			if (passable(next) && m_dist[next] == wanted)
+			{
+				supported = true;
+				break;
+			}
+		}
+		if (supported)
+		{
+			continue;
+		}
+
+		int raised = ++m_dist[cell];
+		if (raised == m_far)
+		{
+			continue;
+		}
+		for (int offset : m_stepOffset)
+		{
+			int next = cell + offset;
+			if (!m_blocked[next] && m_dist[next] == raised
+				&& m_queuedIn[next] != m_update)
+			{
+				m_queuedIn[next] = m_update;
+				m_queue[tail++] = next;
+			}
+		}
+	}
+}
@@ -0,0 +1,110 @@
+/*********************************************************************
+** Program name: DistanceField.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the DistanceField class.
+**				Holds the number of steps from a source cell (the
+**				player) to the cells of the room around it, going
+**				around blocked cells. Used by the ThiefGame class so
+**				the thief can keep away from the player.
+**				Only distances up to a horizon are kept: any cell
+**				further away (or that can't be reached) is given a
+**				distance of one past the horizon. This keeps the
+**				work for a move of the source to the area around
+**				the source, however big the room is.
+**				When the source moves to an adjacent cell the field
+**				is updated rather than worked out again. Every
+**				distance changes by at most one in such a move, so
+**				the update is done in two waves: one from the new
+**				source that lowers the cells that are now closer,
+**				and one from the old source that raises the cells
+**				that have lost their shortest path. Only the cells
+**				whose distance changes are visited. Any other change
+**				(the source jumping, or cells being blocked or
+**				unblocked) works the field out again in full, the
+**				next time the source is set.
+*********************************************************************/
+
+#ifndef DISTANCEFIELD_HPP
+#define DISTANCEFIELD_HPP
+
+#include <vector>
+
+class DistanceField {
+	public:
+		// Constructor. The parameters are the number of rows
+		// and columns in the room and the horizon (the furthest
+		// distance kept). No cells are blocked.
+		DistanceField(int rows, int cols, int horizon);
+
+		// Sets whether the cell at the given row and column is
+		// blocked. The source may stand on a blocked cell, but
+		// paths can't pass through one. No return value.
+		void setBlocked(int row, int col, bool blocked);
+
+		// Moves the source to the cell at the given row and
+		// column and brings the field up to date. No return
+		// value.
+		void setSource(int row, int col);
+
+		// Returns the number of steps from the source to the
+		// cell at the given row and column, or getFar() if the
+		// cell is beyond the horizon or can't be reached.
+		int distance(int row, int col) const;
+
+		// Returns the distance given to cells beyond the horizon
+		// (one past the horizon).
+		int getFar() const;
+
+	private:
+		// returned in place of a cell when there is none
+		static constexpr int NO_CELL = -1;
+
+		// the size of the room, and the width of a row of the
+		// padded room (the room plus a blocked border)
+		int m_rows;
+		int m_cols;
+		int m_stride;
+
+		// the distance given to cells beyond the horizon
+		int m_far;
+
+		// the change in padded cell of a step in each direction
+		// (up, right, down, left)
+		int m_stepOffset[4];
+
+		// for each padded cell: the distance from the source and
+		// whether the cell is blocked
+		std::vector<int> m_dist;
+		std::vector<unsigned char> m_blocked;
+
+		// the padded cell of the source (NO_CELL if not set yet)
+		// and true if the field must be worked out in full
+		int m_source;
+		bool m_stale;
+
+		// cells waiting to be visited, and the update in which
+		// each cell was last queued (so it is only queued once
+		// per update)
+		std::vector<int> m_queue;
+		std::vector<unsigned int> m_queuedIn;
+		unsigned int m_update;
+
+		// returns the padded cell for the given row and column
+		int paddedCell(int row, int col) const;
+
+		// returns true if a path may pass through the cell
+		bool passable(int cell) const;
+
+		// works out the field in full from the source
+		void recompute();
+
+		// lowers the cells that are closer to the new source
+		void lowerFrom(int newSource);
+
+		// raises the cells that lost their shortest path when
+		// the source left the given cell
+		void raiseFrom(int oldSource);
+};
+
+#endif
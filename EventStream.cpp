@@ -0,0 +1,180 @@
+/*********************************************************************
+** Program name: EventStream.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the EventStream class.
+**				Used with the ThiefGame class to write a compact
+**				binary record of a game to a file descriptor (ex. a
+**				file or a pipe), so that viewers can follow games
+**				without reading the console output. Events are 
+**				collected in a buffer and written once per frame by
+**				the flush method. See EventStream.hpp for the 
+**				format of the stream.
+*********************************************************************/
+
+#include "EventStream.hpp"
+#include <string>
+#include <vector>
+#include <cerrno>
+#include <unistd.h>
+
+/****************************************************************
+Constructor. The single parameter is the file descriptor the 
+events are written to. The stream header ("FTTE" and the format
+version) is written straight away.
+****************************************************************/
+
+EventStream::EventStream(int fd)
+	: m_fd{ fd }
+{
+	static constexpr unsigned int VERSION{ 1 };
+
+	m_buffer.push_back('F');
+	m_buffer.push_back('T');
+	m_buffer.push_back('T');
+	m_buffer.push_back('E');
+	putVarint(VERSION);
+	flush();
+}
+
+/****************************************************************
+Adds a number to the buffer as a varint. Seven bits are stored 
+per byte, starting with the lowest bits, and the high bit is set
+on every byte except the last. No return value.
+****************************************************************/
+
+void EventStream::putVarint(unsigned int value)
+{
+	while (value >= 0x80)
+	{
+		m_buffer.push_back(static_cast<unsigned char>(value | 0x80));
+		value >>= 7;
+	}
+	m_buffer.push_back(static_cast<unsigned char>(value));
+}
+
+/****************************************************************
+Adds text to the buffer as its length (a varint) followed by its
+characters. No return value.
+****************************************************************/
+
+void EventStream::putString(const std::string &text)
+{
+	putVarint(text.length());
+	m_buffer.insert(m_buffer.end(), text.begin(), text.end());
+}
+
+/****************************************************************
+Adds a GAME_START event with the size of the room.
+****************************************************************/
+
+void EventStream::gameStart(int rows, int cols)
+{
+	putVarint(GAME_START);
+	putVarint(rows);
+	putVarint(cols);
+}
+
+/****************************************************************
+Adds a TILE event giving the symbol now shown for a cell.
+****************************************************************/
+
+void EventStream::tile(int cell, char symbol)
+{
+	putVarint(TILE);
+	putVarint(cell);
+	putVarint(static_cast<unsigned char>(symbol));
+}
+
+/****************************************************************
+Adds a PLAYER event giving the cell the player is on.
+****************************************************************/
+
+void EventStream::player(int cell)
+{
+	putVarint(PLAYER);
+	putVarint(cell);
+}
+
+/****************************************************************
+Adds a CLOCK event giving the game time as minutes since 
+midnight.
+****************************************************************/
+
+void EventStream::clock(int minuteOfDay)
+{
+	putVarint(CLOCK);
+	putVarint(minuteOfDay);
+}
+
+/****************************************************************
+Adds an ITEM event. The first parameter is the item number and 
+the second holds true if the item was added to the backpack and
+false if it was used.
+****************************************************************/
+
+void EventStream::item(int itemNumber, bool added)
+{
+	putVarint(ITEM);
+	putVarint(itemNumber);
+	putVarint(added ? 1 : 0);
+}
+
+/****************************************************************
+Adds a NOTE event holding the text of a new notepad entry.
+****************************************************************/
+
+void EventStream::note(const std::string &text)
+{
+	putVarint(NOTE);
+	putString(text);
+}
+
+/****************************************************************
+Adds a GAME_END event. The parameter holds true if the thief was
+caught.
+****************************************************************/
+
+void EventStream::gameEnd(bool caught)
+{
+	putVarint(GAME_END);
+	putVarint(caught ? 1 : 0);
+}
+
+/****************************************************************
+Writes the buffered events to the file descriptor and empties the
+buffer. If the write fails, the stream stops writing (the game 
+carries on without it). No parameters and no return value.
+****************************************************************/
+
+void EventStream::flush()
+{
+	std::size_t written = 0;
+	while (m_fd >= 0 && written < m_buffer.size())
+	{
+		ssize_t result = write(m_fd, m_buffer.data() + written, 
+			m_buffer.size() - written);
+		if (result < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (result <= 0)
+		{
+			m_fd = -1;
+		}
+		else
+		{
+			written += result;
+		}
+	}
+	m_buffer.clear();
+}
+
+/****************************************************************
+Destructor. Writes any events that are still buffered.
+****************************************************************/
+
+EventStream::~EventStream()
+{
+	flush();
+}
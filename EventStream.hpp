@@ -0,0 +1,91 @@
+/*********************************************************************
+** Program name: EventStream.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the EventStream class.
+**				Used with the ThiefGame class to write a compact
+**				binary record of a game to a file descriptor (ex. a
+**				file or a pipe), so that viewers can follow games
+**				without reading the console output. Events are 
+**				collected in a buffer and written once per frame by
+**				the flush method.
+**				Format: the stream starts with the bytes "FTTE"
+**				followed by the format version. Every event is then
+**				a type number followed by its fields. All numbers are
+**				unsigned varints (7 bits per byte, low bits first,
+**				high bit set on every byte but the last) and text is
+**				a varint length followed by the characters.
+**				- GAME_START: rows, columns
+**				- TILE: cell (row * columns + column), symbol
+**				- PLAYER: cell
+**				- CLOCK: minutes since midnight
+**				- ITEM: item number (1 fireworks, 2 truth candy bar),
+**				  1 if the item was added and 0 if it was used
+**				- NOTE: text of a new notepad entry
+**				- GAME_END: 1 if the thief was caught, 0 otherwise
+**				A game begins with GAME_START and the full room (a
+**				TILE for every cell, then PLAYER and CLOCK). After 
+**				that only changes are sent.
+*********************************************************************/
+
+#ifndef EVENTSTREAM_HPP
+#define EVENTSTREAM_HPP
+
+#include <string>
+#include <vector>
+
+class EventStream {
+	private:
+		// file descriptor the events are written to. Set to
+		// -1 if writing fails (ex. the viewer closed the pipe).
+		int m_fd;
+		// bytes that have not yet been written
+		std::vector<unsigned char> m_buffer;
+
+		// adds a number to the buffer as a varint
+		void putVarint(unsigned int value);
+
+		// adds text to the buffer as a length and characters
+		void putString(const std::string &text);
+	public:
+		// the event type numbers
+		enum EventType {
+			GAME_START = 1,
+			TILE,
+			PLAYER,
+			CLOCK,
+			ITEM,
+			NOTE,
+			GAME_END
+		};
+
+		// the item numbers used by ITEM events
+		enum ItemNumber {
+			FIREWORKS_ITEM = 1,
+			TRUTH_CANDY_ITEM
+		};
+
+		// Constructor. The single parameter is the file 
+		// descriptor to write to. The stream header is written
+		// straight away.
+		EventStream(int fd);
+
+		// methods that add a single event to the buffer. The 
+		// parameters are the fields of the event.
+		void gameStart(int rows, int cols);
+		void tile(int cell, char symbol);
+		void player(int cell);
+		void clock(int minuteOfDay);
+		void item(int itemNumber, bool added);
+		void note(const std::string &text);
+		void gameEnd(bool caught);
+
+		// Writes the buffered events to the file descriptor.
+		// No parameters and no return value.
+		void flush();
+
+		// Destructor. Writes any events still buffered.
+		~EventStream();
+};
+
+#endif
@@ -0,0 +1,91 @@
+/*********************************************************************
+** Program name: Fact.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the facts written in the
+**				notepad. See Fact.hpp for what each kind of fact
+**				holds.
+*********************************************************************/
+
+#include "Fact.hpp"
+#include "Messages.hpp"
+#include "GuestTable.hpp"
+#include <string_view>
+#include <vector>
+
+/****************************************************************
+Returns the Message used to show a fact in the notepad. The first
+parameter is the fact and the second parameter holds the guests
+of the party (indexed by guest id).
+****************************************************************/
+
+Message factMessage(const Fact &fact, const GuestTable &guests)
+{
+	Message msg;
+	if (fact.guest != Fact::NO_GUEST)
+	{
+		msg.name = guests.getNameId(fact.guest);
+		msg.male = guests.isMale(fact.guest);
+	}
+
+	switch (fact.kind)
+	{
+		case FACT_MAP_SYMBOL:
+		{
+			msg.id = static_cast<MsgId>(MSG_SYMBOL_PLAYER + fact.value);
+			break;
+		}
+		case FACT_MET_GUEST:
+		{
+			msg.id = MSG_MET_GUEST;
+			break;
+		}
+		case FACT_CLUE_GENDER:
+		{
+			msg.id = MSG_CLUE_GENDER_NOTE;
+			msg.male = fact.value != 0;
+			break;
+		}
+		case FACT_CLUE_LETTER:
+		{
+			msg.id = MSG_CLUE_LETTER_NOTE;
+			msg.letter = static_cast<char>(fact.value);
+			break;
+		}
+		case FACT_GROUP_GENDER:
+		{
+			msg.id = MSG_GROUP_GENDER_NOTE;
+			msg.male = fact.value != 0;
+			break;
+		}
+		case FACT_GROUP_LETTER:
+		{
+			msg.id = MSG_GROUP_LETTER_NOTE;
+			msg.letter = static_cast<char>(fact.value);
+			break;
+		}
+		case FACT_TRUTH:
+		{
+			msg.id = fact.value != 0 ? MSG_TRUTH_ADMIT_NOTE
+				: MSG_TRUTH_DENY_NOTE;
+			break;
+		}
+		case FACT_GUEST_LEFT:
+		{
+			msg.id = fact.value != 0 ? MSG_GUEST_LEFT
+				: MSG_UNMET_GUEST_LEFT;
+			break;
+		}
+		case FACT_END_TIME:
+		{
+			msg.id = MSG_NEW_END_TIME;
+			msg.time = fact.value;
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+	return msg;
+}
@@ -0,0 +1,67 @@
+/*********************************************************************
+** Program name: Fact.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the facts written in the notepad.
+**				Every note the player takes is stored as a small
+**				typed record (a Fact) rather than as text: what kind
+**				of note it is, the guest it is about (by guest id),
+**				a value and the game minute it was noted. The text
+**				of a note is only made (by factMessage) when the
+**				notepad is read, and bots can use the facts directly.
+**				The value of a Fact depends on its kind:
+**				- FACT_MAP_SYMBOL: which map symbol (0 for the player,
+**				  in the order of the map symbol messages)
+**				- FACT_MET_GUEST: unused
+**				- FACT_CLUE_GENDER: 1 if the thief is male
+**				- FACT_CLUE_LETTER: a letter in the thief's name
+**				- FACT_TRUTH: 1 if the guest admitted to the theft
+**				  (or to being one of the culprits)
+**				- FACT_GUEST_LEFT: 1 if the player had met the guest
+**				  (guests the player has not met have no guest id)
+**				- FACT_END_TIME: the new end time (minutes since
+**				  midnight)
+**				- FACT_GROUP_GENDER: 1 if one of the culprits is male
+**				  (games with more than one culprit)
+**				- FACT_GROUP_LETTER: a letter in one of the culprits'
+**				  names (games with more than one culprit)
+*********************************************************************/
+
+#ifndef FACT_HPP
+#define FACT_HPP
+
+#include <string_view>
+#include <vector>
+#include "Messages.hpp"
+#include "GuestTable.hpp"
+
+// the kinds of fact
+enum FactKind : unsigned char {
+	FACT_NONE = 0,
+	FACT_MAP_SYMBOL,
+	FACT_MET_GUEST,
+	FACT_CLUE_GENDER,
+	FACT_CLUE_LETTER,
+	FACT_TRUTH,
+	FACT_GUEST_LEFT,
+	FACT_END_TIME,
+	FACT_GROUP_GENDER,
+	FACT_GROUP_LETTER
+};
+
+// a single note in the notepad
+struct Fact {
+	// guest id used when the fact is not about a guest
+	static constexpr short NO_GUEST = -1;
+
+	FactKind kind = FACT_NONE;
+	short guest = NO_GUEST;
+	short value = 0;
+	short minute = 0;
+};
+
+// returns the Message used to show a fact in the notepad. The
+// second parameter holds the guests the fact may refer to.
+Message factMessage(const Fact &fact, const GuestTable &guests);
+
+#endif
@@ -9,15 +9,12 @@
 *********************************************************************/
 
 #include "FireworksBox.hpp"
-#include <iostream>
+#include "Messages.hpp"
 #include <string>
 
 // intitialize the TYPE static constant which represents the
 // type of the Space
 const std::string FireworksBox::TYPE{ "FireworksBox" };
-// initialize the ITEM static constant which repesents the type
-// of item held in the Space
-const std::string FireworksBox::ITEM{ "Fireworks" };
 
 /****************************************************************
 Default constructor. 
@@ -49,24 +46,23 @@ std::string FireworksBox::statType()
 }
 
 /****************************************************************
-Returns the ITEM string. No parameters. Static method so can be 
-used without an object instance.
+Returns the id of the item held in the box. No parameters. 
+Static method so can be used without an object instance.
 ****************************************************************/
 
-std::string FireworksBox::statItem()
+ItemId FireworksBox::statItem()
 {
-	return ITEM;
+	return FIREWORKS_ITEM_ID;
 }
 
 /****************************************************************
-Prints a single character to the console representing the
-FireworksBox space. The method takes no parameters and has no return 
-value.
+Returns the single character that represents the FireworksBox
+space on the map. The method takes no parameters.
 ****************************************************************/
 
-void FireworksBox::printSpace() const
+char FireworksBox::getSymbol() const
 {
-	std::cout << "F"; 
+	return 'F';
 }
 
 /****************************************************************
@@ -77,18 +73,17 @@ holding the TYPE value.
 
 std::string FireworksBox::event()
 {
-	std::cout << "\nYou open up a box on the ground and pull out"
-		<< " fireworks.\n"; 
+	say(Message{ MSG_FIREWORKS_FOUND });
 	return TYPE;
 }
 
 /****************************************************************
-Returns information related to the FireworksBox as a string. 
+Returns information related to the FireworksBox as a Fact. 
 Given that FireworksBox spaces do not contain any information, 
-the method returns an empty string.
+the method returns an empty Fact.
 ****************************************************************/
 
-std::string FireworksBox::information() 
+Fact FireworksBox::information() 
 {
-	return "";	
+	return Fact();	
 }
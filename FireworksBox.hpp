@@ -12,12 +12,13 @@
 #define FIREWORKSBOX_HPP
 
 #include "Space.hpp"
+#include "Fact.hpp"
+#include "Item.hpp"
 #include <string>
 
 class FireworksBox : public Space {
 	private:	
 		static const std::string TYPE;
-		static const std::string ITEM;
 	public:
 		// Default constructor
 		FireworksBox();
@@ -33,12 +34,12 @@ class FireworksBox : public Space {
 		// object instance.
 		static std::string statType();
 
-		// Returns the ITEM static constant string.
-		static std::string statItem();
+		// Returns the id of the item held in this Space.
+		static ItemId statItem();
 
-		// Prints a single character to the console
-		// representing the FireworksBox space.
-		virtual void printSpace() const override;
+		// Returns the single character that represents
+		// the FireworksBox space on the map.
+		virtual char getSymbol() const override;
 
 		// Performs an event related to the FireworksBox
 		// and returns a string representing the
@@ -46,8 +47,8 @@ class FireworksBox : public Space {
 		virtual std::string event() override;
 
 		// Returns information related to the FireworksBox
-		// as a string. No parameters.
-		virtual std::string information() override;	
+		// as a Fact. No parameters.
+		virtual Fact information() override;	
 };
 
 #endif
@@ -47,14 +47,13 @@ std::string Floor::statType()
 }
 
 /****************************************************************
-Prints a single character to the console representing the
-Floor space. The method takes no parameters and has no return 
-value.
+Returns the single character that represents the Floor
+space on the map. The method takes no parameters.
 ****************************************************************/
 
-void Floor::printSpace() const
+char Floor::getSymbol() const
 {
-	std::cout << " "; 
+	return ' ';
 }
 
 /****************************************************************
@@ -68,12 +67,12 @@ std::string Floor::event()
 }
 
 /****************************************************************
-Returns information related to the Floor as a string. Given that
+Returns information related to the Floor as a Fact. Given that
 Floor spaces do not contain any information, the method returns
-an empty string.
+an empty Fact.
 ****************************************************************/
 
-std::string Floor::information() 
+Fact Floor::information() 
 {
-	return "";	
+	return Fact();	
 }
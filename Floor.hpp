@@ -14,6 +14,7 @@
 #define FLOOR_HPP
 
 #include "Space.hpp"
+#include "Fact.hpp"
 #include <string>
 
 class Floor : public Space {
@@ -34,9 +35,9 @@ class Floor : public Space {
 		// object instance.
 		static std::string statType();
 
-		// Prints a single character to the console
-		// representing the Floor space.
-		virtual void printSpace() const override;
+		// Returns the single character that represents
+		// the Floor space on the map.
+		virtual char getSymbol() const override;
 
 		// Performs an event related to the Floor
 		// and returns a string representing the
@@ -44,8 +45,8 @@ class Floor : public Space {
 		virtual std::string event() override;
 
 		// Returns information related to the Floor
-		// as a string. No parameters.
-		virtual std::string information() override;	
+		// as a Fact. No parameters.
+		virtual Fact information() override;	
 };
 
 #endif
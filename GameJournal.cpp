@@ -0,0 +1,383 @@
+/*********************************************************************
+** Program name: GameJournal.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the GameJournal class.
+**				See GameJournal.hpp for the journal format.
+*********************************************************************/
+
+#include "GameJournal.hpp"
+#include "Snapshot.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+/****************************************************************
+Constructor. The journal starts closed, so nothing is written
+until a file is opened.
+****************************************************************/
+
+GameJournal::GameJournal()
+	: m_fd{ -1 },
+	  m_syncMs{ DEFAULT_SYNC_MS },
+	  m_unsynced{ false }
+{
+}
+
+/****************************************************************
+Destructor. Anything not yet written is written and flushed to
+disk before the journal is closed.
+****************************************************************/
+
+GameJournal::~GameJournal()
+{
+	if (m_fd != -1)
+	{
+		sync();
+		close(m_fd);
+	}
+}
+
+/****************************************************************
+Opens the journal file. The first parameter is the path of the
+file, which is created if it does not exist. The second parameter
+is the number of milliseconds between flushes to disk (0 flushes
+on every commit). A journal left by an earlier run is read: its
+last snapshot and the input after it are kept (see getSnapshot
+and getTail), and anything after its last whole record (a record
+cut short by a crash) is cut off. An empty file is started as a
+new journal. Any other file that does not start with a valid 
+journal header is left as it is and the journal is not opened. 
+Returns true if the journal was opened.
+****************************************************************/
+
+bool GameJournal::open(const char* path, int syncMs)
+{
+	if (m_fd != -1)
+	{
+		sync();
+		close(m_fd);
+	}
+	m_path = path;
+	m_syncMs = syncMs;
+	m_pending.clear();
+	m_unsynced = false;
+	m_snapshot.clear();
+	m_tail.clear();
+
+	std::vector<unsigned char> journal;
+	std::size_t validSize = 0;
+	if (readSnapshotFile(path, journal))
+	{
+		validSize = readRecords(journal);
+		// the file is not a journal, so it must not be cut back
+		if (validSize == 0 && !journal.empty())
+		{
+			return false;
+		}
+	}
+
+	m_fd = ::open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+	if (m_fd == -1)
+	{
+		return false;
+	}
+	if (ftruncate(m_fd, validSize) != 0)
+	{
+		close(m_fd);
+		m_fd = -1;
+		return false;
+	}
+
+	// an empty journal starts with the header
+	if (validSize == 0)
+	{
+		SnapshotWriter out(m_pending);
+		out.putBytes(MAGIC, MAGIC_LENGTH);
+		out.putVarint(VERSION);
+	}
+	m_lastSync = std::chrono::steady_clock::now();
+	return true;
+}
+
+/****************************************************************
+Helper method to open. Reads the journal passed as the parameter
+record by record, keeping the last snapshot and the lines of
+input after it. Reading stops at the end of the journal or at the
+first record that is cut short or fails its checksum. Returns the
+number of bytes up to the end of the last valid record, or 0 if
+the journal doesn't start with a valid header.
+****************************************************************/
+
+std::size_t GameJournal::readRecords(const std::vector<unsigned char> &journal)
+{
+	SnapshotReader in(journal.data(), journal.size());
+	if (!in.expectBytes(MAGIC, MAGIC_LENGTH) || in.getVarint() != VERSION)
+	{
+		return 0;
+	}
+
+	std::size_t validSize = journal.size() - in.remaining();
+	while (in.remaining() > 0)
+	{
+		RecordKind kind = static_cast<RecordKind>(in.getAtMost(INPUT_RECORD));
+		std::size_t length = in.getVarint();
+		const unsigned char* data = in.getBytes(length);
+		const unsigned char* sum = in.getBytes(CHECKSUM_LENGTH);
+		if (!in.ok() || kind < SNAPSHOT_RECORD)
+		{
+			break;
+		}
+		std::uint32_t expected = checksum(kind, data, length);
+		if (sum[0] != (expected & 0xFF) || sum[1] != ((expected >> 8) & 0xFF)
+			|| sum[2] != ((expected >> 16) & 0xFF) || sum[3] != (expected >> 24))
+		{
+			break;
+		}
+
+		if (kind == SNAPSHOT_RECORD)
+		{
+			m_snapshot.assign(data, data + length);
+			m_tail.clear();
+		}
+		else
+		{
+			m_tail.append(reinterpret_cast<const char*>(data), length);
+			m_tail.push_back('\n');
+		}
+		validSize = journal.size() - in.remaining();
+	}
+	return validSize;
+}
+
+/****************************************************************
+Returns true if the journal file opened held a snapshot, so the
+game it journaled can be restored.
+****************************************************************/
+
+bool GameJournal::hasSnapshot() const
+{
+	return !m_snapshot.empty();
+}
+
+/****************************************************************
+Returns the last snapshot in the journal file opened (empty if
+there was none).
+****************************************************************/
+
+const std::vector<unsigned char>& GameJournal::getSnapshot() const
+{
+	return m_snapshot;
+}
+
+/****************************************************************
+Returns the input entered after the last snapshot in the journal
+file opened, as lines that each end with a newline (see
+replayInput).
+****************************************************************/
+
+const std::string& GameJournal::getTail() const
+{
+	return m_tail;
+}
+
+/****************************************************************
+Returns the 32-bit FNV-1a checksum of a record. The parameters are
+the record's kind, its data and the length of the data.
+****************************************************************/
+
+std::uint32_t GameJournal::checksum(RecordKind kind,
+	const unsigned char* data, std::size_t length)
+{
+	static constexpr std::uint32_t FNV_OFFSET = 2166136261u;
+	static constexpr std::uint32_t FNV_PRIME = 16777619u;
+
+	std::uint32_t hash = (FNV_OFFSET ^ kind) * FNV_PRIME;
+	for (std::size_t i = 0; i < length; i++)
+	{
+		hash = (hash ^ data[i]) * FNV_PRIME;
+	}
+	return hash;
+}
+
+/****************************************************************
+Adds a record to the end of the vector passed as the first
+parameter: the kind (second parameter), the length of the data,
+the data (third parameter, with the length as the last parameter)
+and the checksum. No return value.
+****************************************************************/
+
+void GameJournal::putRecord(std::vector<unsigned char> &out,
+	RecordKind kind, const unsigned char* data, std::size_t length)
+{
+	SnapshotWriter writer(out);
+	writer.putVarint(kind);
+	writer.putVarint(length);
+	out.insert(out.end(), data, data + length);
+
+	std::uint32_t sum = checksum(kind, data, length);
+	for (int i = 0; i < CHECKSUM_LENGTH; i++)
+	{
+		out.push_back(static_cast<unsigned char>(sum >> (8 * i)));
+	}
+}
+
+/****************************************************************
+Starts the journal again from a snapshot of the game (the single
+parameter). A new journal holding only the snapshot replaces the
+file in one step, so the file always holds either the old journal
+or the new one in full. The input not yet written belongs before
+the snapshot and is dropped. If the new journal can't be written
+the old one is kept and carries on. Returns true if the new
+journal was written.
+****************************************************************/
+
+bool GameJournal::addSnapshot(const std::vector<unsigned char> &snapshot)
+{
+	if (m_fd == -1)
+	{
+		return false;
+	}
+
+	std::vector<unsigned char> journal;
+	SnapshotWriter out(journal);
+	out.putBytes(MAGIC, MAGIC_LENGTH);
+	out.putVarint(VERSION);
+	putRecord(journal, SNAPSHOT_RECORD, snapshot.data(), snapshot.size());
+	if (!writeSnapshotFile(m_path.c_str(), journal))
+	{
+		return false;
+	}
+
+	// the file just written was flushed to disk, so the journal
+	// carries on from it
+	int fd = ::open(m_path.c_str(), O_WRONLY | O_APPEND);
+	if (fd == -1)
+	{
+		return false;
+	}
+	close(m_fd);
+	m_fd = fd;
+	m_pending.clear();
+	m_unsynced = false;
+	m_lastSync = std::chrono::steady_clock::now();
+	return true;
+}
+
+/****************************************************************
+Adds a line of input (the parameter, without the newline) to the
+records waiting to be written. Nothing is written until the next
+commit. No return value.
+****************************************************************/
+
+void GameJournal::addInput(std::string_view line)
+{
+	if (m_fd == -1)
+	{
+		return;
+	}
+	putRecord(m_pending, INPUT_RECORD,
+		reinterpret_cast<const unsigned char*>(line.data()), line.length());
+}
+
+/****************************************************************
+Helper method to commit and sync. Writes every pending record to
+the end of the file. Records that could not be written stay
+pending and are tried again on the next commit. Returns true if
+every record was written.
+****************************************************************/
+
+bool GameJournal::writePending()
+{
+	std::size_t written = 0;
+	while (written < m_pending.size())
+	{
+		ssize_t result = write(m_fd, m_pending.data() + written,
+			m_pending.size() - written);
+		if (result < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (result <= 0)
+		{
+			break;
+		}
+		written += result;
+		m_unsynced = true;
+	}
+	m_pending.erase(m_pending.begin(), m_pending.begin() + written);
+	return m_pending.empty();
+}
+
+/****************************************************************
+Commits the records added since the last commit: they are written
+to the file together, and the file is flushed to disk if the sync
+interval has passed since the last flush. Called once a turn, so
+a turn costs a single write and at most one flush per interval.
+No parameters and no return value.
+****************************************************************/
+
+void GameJournal::commit()
+{
+	if (m_fd == -1 || !writePending() || !m_unsynced)
+	{
+		return;
+	}
+
+	std::chrono::steady_clock::time_point now =
+		std::chrono::steady_clock::now();
+	if (now - m_lastSync >= std::chrono::milliseconds(m_syncMs))
+	{
+		if (fdatasync(m_fd) == 0)
+		{
+			m_unsynced = false;
+		}
+		m_lastSync = now;
+	}
+}
+
+/****************************************************************
+Writes the records not yet written and flushes the file to disk
+straight away. No parameters and no return value.
+****************************************************************/
+
+void GameJournal::sync()
+{
+	if (m_fd == -1)
+	{
+		return;
+	}
+	writePending();
+	if (m_unsynced && fdatasync(m_fd) == 0)
+	{
+		m_unsynced = false;
+	}
+	m_lastSync = std::chrono::steady_clock::now();
+}
+
+/****************************************************************
+Closes the journal and removes its file, once the game it journals
+is over and has nothing left to restore. No parameters and no
+return value.
+****************************************************************/
+
+void GameJournal::discard()
+{
+	if (m_fd == -1)
+	{
+		return;
+	}
+	close(m_fd);
+	m_fd = -1;
+	unlink(m_path.c_str());
+	m_pending.clear();
+	m_unsynced = false;
+	m_snapshot.clear();
+	m_tail.clear();
+}
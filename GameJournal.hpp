@@ -0,0 +1,153 @@
+/*********************************************************************
+** Program name: GameJournal.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the GameJournal class.
+**				An append-only journal of a game, kept so that a game
+**				can be picked up again if the program dies while it
+**				is being played. The journal holds a snapshot of the
+**				game (see ThiefGame::save) followed by every line of
+**				input the player has entered since. A game is
+**				restored by loading the last snapshot and replaying
+**				the lines after it.
+**				Writes are grouped: records are added to a buffer and
+**				written with a single write when the game commits
+**				(once a turn), and the file is only flushed to disk
+**				once the sync interval has passed since the last
+**				flush. A crash of the program loses nothing that was
+**				committed, and a crash of the machine loses at most
+**				the last sync interval.
+**				Each new snapshot starts the journal again: the file
+**				is replaced in one step (see writeSnapshotFile) by
+**				one holding only the snapshot, so the journal never
+**				grows past a snapshot and the input of a few turns.
+**				Journal format: the bytes "FTTJ" and the version (a
+**				varint), then the records. Each record is its kind
+**				(a byte), the length of its data (a varint), the data
+**				and a 32-bit FNV-1a checksum of the kind and data
+**				(low byte first). Reading stops at the first record
+**				that is cut short or fails its checksum, which is
+**				where a crash stopped the journal, and the file is
+**				cut back to the records before it.
+*********************************************************************/
+
+#ifndef GAMEJOURNAL_HPP
+#define GAMEJOURNAL_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class GameJournal {
+	public:
+		// the kinds of record: a snapshot of the game, or a line
+		// of input
+		enum RecordKind { SNAPSHOT_RECORD = 1, INPUT_RECORD };
+
+		// the default number of milliseconds between flushes to
+		// disk
+		static constexpr int DEFAULT_SYNC_MS = 100;
+
+		// Constructor. The journal starts closed.
+		GameJournal();
+
+		// the journal owns its file so it cannot be copied
+		GameJournal(const GameJournal&) = delete;
+		GameJournal& operator=(const GameJournal&) = delete;
+
+		// Destructor. Writes and flushes anything not yet written
+		// and closes the journal.
+		~GameJournal();
+
+		// Opens the journal file whose path is the first parameter,
+		// creating it if needed. The second parameter is the number
+		// of milliseconds between flushes to disk (0 flushes on
+		// every commit). The last snapshot in the file and the input
+		// after it are kept to restore the game. Returns true if the
+		// journal was opened, and false (leaving the file as it is)
+		// if the file is not empty and is not a journal.
+		bool open(const char* path, int syncMs);
+
+		// Returns true if the file opened held a snapshot.
+		bool hasSnapshot() const;
+
+		// Returns the last snapshot in the file opened.
+		const std::vector<unsigned char>& getSnapshot() const;
+
+		// Returns the input entered after the last snapshot in the
+		// file opened, as lines that each end with a newline.
+		const std::string& getTail() const;
+
+		// Starts the journal again from a snapshot of the game (the
+		// parameter). Returns true if the new journal was written.
+		bool addSnapshot(const std::vector<unsigned char> &snapshot);
+
+		// Adds a line of input (without the newline). No return
+		// value.
+		void addInput(std::string_view line);
+
+		// Writes the records added since the last commit, and
+		// flushes the file to disk if the sync interval has passed.
+		// No parameters and no return value.
+		void commit();
+
+		// Writes the records not yet written and flushes the file to
+		// disk. No parameters and no return value.
+		void sync();
+
+		// Closes the journal and removes its file (ex. once the game
+		// is over). No parameters and no return value.
+		void discard();
+
+	private:
+		// the bytes a journal starts with and the version of the
+		// journal format
+		static constexpr char MAGIC[] = "FTTJ";
+		static constexpr int MAGIC_LENGTH = 4;
+		static constexpr unsigned int VERSION = 1;
+		// the number of bytes in a record's checksum
+		static constexpr int CHECKSUM_LENGTH = 4;
+
+		// the path and descriptor of the journal file (-1 when
+		// closed), and the milliseconds between flushes
+		std::string m_path;
+		int m_fd;
+		int m_syncMs;
+
+		// the records not yet written, whether anything written
+		// has not been flushed, and the time of the last flush
+		std::vector<unsigned char> m_pending;
+		bool m_unsynced;
+		std::chrono::steady_clock::time_point m_lastSync;
+
+		// the last snapshot in the file opened and the input after
+		// it
+		std::vector<unsigned char> m_snapshot;
+		std::string m_tail;
+
+		// Adds a record (kind, then data and its length) to the
+		// end of the vector passed as the first parameter. No return
+		// value.
+		static void putRecord(std::vector<unsigned char> &out,
+			RecordKind kind, const unsigned char* data,
+			std::size_t length);
+
+		// Returns the checksum of a record's kind and data.
+		static std::uint32_t checksum(RecordKind kind,
+			const unsigned char* data, std::size_t length);
+
+		// Reads the journal in the vector passed as the parameter,
+		// keeping the last snapshot and the input after it. Returns
+		// the number of bytes of whole, valid records (including
+		// the header), or 0 if the header is not valid.
+		std::size_t readRecords(const std::vector<unsigned char> &journal);
+
+		// Writes every pending record to the file. Returns true if
+		// they were all written.
+		bool writePending();
+};
+
+#endif
@@ -0,0 +1,34 @@
+/*********************************************************************
+** Program name: GameOptions.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the GameOptions struct.
+**				Holds the settings that a ThiefGame is started with.
+**				The default values give the normal turn based game.
+*********************************************************************/
+
+#ifndef GAMEOPTIONS_HPP
+#define GAMEOPTIONS_HPP
+
+struct GameOptions {
+	// number of real (wall clock) milliseconds that each minute
+	// of the party lasts in the real-time game. A value of 0
+	// gives the turn based game, where each move takes a minute.
+	int minuteMs = 0;
+
+	// number of items the player's backpack can hold at once
+	int backpackSlots = 1;
+
+	// true if the guests wander around the room (gathering near
+	// the stereo and keeping away from the player) rather than
+	// staying where they are placed
+	bool movingGuests = false;
+
+	// number of culprits (the thief and any accomplices), from
+	// 1 to CulpritSolver::MAX_CULPRITS. With more than one, the
+	// clues describe the group and the player must name all of
+	// them.
+	int numCulprits = 1;
+};
+
+#endif
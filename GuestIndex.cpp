@@ -0,0 +1,167 @@
+/*********************************************************************
+** Program name: GuestIndex.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the GuestIndex class.
+**				See GuestIndex.hpp.
+*********************************************************************/
+
+#include "GuestIndex.hpp"
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+/****************************************************************
+Constructor. The first parameter is the number of rows in the
+room and the second parameter is the number of columns. The
+index starts with no guests.
+****************************************************************/
+
+GuestIndex::GuestIndex(int rows, int cols)
+	: m_rows{ rows },
+	  m_cols{ cols },
+	  m_regionCols{ ((cols - 1) >> REGION_SHIFT) + 1 },
+	  m_cellGuest(rows * cols, NO_GUEST),
+	  m_regions((((rows - 1) >> REGION_SHIFT) + 1) * m_regionCols),
+	  m_count{ 0 }
+{
+}
+
+/****************************************************************
+Returns the region holding the cell passed as the parameter.
+****************************************************************/
+
+int GuestIndex::regionOf(int cell) const
+{
+	int row = cell / m_cols;
+	int col = cell % m_cols;
+	return (row >> REGION_SHIFT) * m_regionCols + (col >> REGION_SHIFT);
+}
+
+/****************************************************************
+Adds a guest to the index. The first parameter is the guest id
+and the other parameters are the row and column of the guest's
+cell. No return value.
+****************************************************************/
+
+void GuestIndex::add(int guestId, int row, int col)
+{
+	if (guestId >= static_cast<int>(m_guestCell.size()))
+	{
+		m_guestCell.resize(guestId + 1, -1);
+		m_bucketSlot.resize(guestId + 1, -1);
+	}
+
+	int cell = row * m_cols + col;
+	std::vector<int> &bucket = m_regions[regionOf(cell)];
+	m_cellGuest[cell] = guestId;
+	m_guestCell[guestId] = cell;
+	m_bucketSlot[guestId] = bucket.size();
+	bucket.push_back(guestId);
+	m_count++;
+}
+
+/****************************************************************
+Removes a guest from the index. The single parameter is the
+guest id. The guest's place in its region's bucket is filled by
+the last guest in the bucket. No return value.
+****************************************************************/
+
+void GuestIndex::remove(int guestId)
+{
+	if (guestId < 0 || guestId >= static_cast<int>(m_guestCell.size())
+		|| m_guestCell[guestId] == -1)
+	{
+		return;
+	}
+
+	int cell = m_guestCell[guestId];
+	std::vector<int> &bucket = m_regions[regionOf(cell)];
+	int lastGuest = bucket.back();
+	bucket[m_bucketSlot[guestId]] = lastGuest;
+	m_bucketSlot[lastGuest] = m_bucketSlot[guestId];
+	bucket.pop_back();
+
+	m_cellGuest[cell] = NO_GUEST;
+	m_guestCell[guestId] = -1;
+	m_bucketSlot[guestId] = -1;
+	m_count--;
+}
+
+/****************************************************************
+Moves a guest to a new cell. The first parameter is the guest id
+and the other parameters are the row and column of the new cell.
+The buckets are only changed if the guest changes region. No
+return value.
+****************************************************************/
+
+void GuestIndex::move(int guestId, int row, int col)
+{
+	int oldCell = m_guestCell[guestId];
+	int newCell = row * m_cols + col;
+	if (regionOf(oldCell) != regionOf(newCell))
+	{
+		remove(guestId);
+		add(guestId, row, col);
+		return;
+	}
+
+	m_cellGuest[oldCell] = NO_GUEST;
+	m_cellGuest[newCell] = guestId;
+	m_guestCell[guestId] = newCell;
+}
+
+/****************************************************************
+Returns the id of the guest in the cell at the given row and
+column, or NO_GUEST if there is no guest in the cell.
+****************************************************************/
+
+int GuestIndex::guestAt(int row, int col) const
+{
+	return m_cellGuest[row * m_cols + col];
+}
+
+/****************************************************************
+Finds every guest within a number of steps of a cell. The first
+two parameters are the row and column of the cell, the third is
+the number of steps (diagonal steps count as one) and the found
+guest ids are placed in the last parameter. Only the regions that
+overlap the area are looked at. No return value.
+****************************************************************/
+
+void GuestIndex::guestsNear(int row, int col, int radius,
+	std::vector<int> &found) const
+{
+	found.clear();
+	int top = std::max(row - radius, 0);
+	int bottom = std::min(row + radius, m_rows - 1);
+	int left = std::max(col - radius, 0);
+	int right = std::min(col + radius, m_cols - 1);
+
+	for (int regRow = top >> REGION_SHIFT;
+		regRow <= bottom >> REGION_SHIFT; regRow++)
+	{
+		for (int regCol = left >> REGION_SHIFT;
+			regCol <= right >> REGION_SHIFT; regCol++)
+		{
+			for (int guestId : m_regions[regRow * m_regionCols + regCol])
+			{
+				int cell = m_guestCell[guestId];
+				if (std::abs(cell / m_cols - row) <= radius
+					&& std::abs(cell % m_cols - col) <= radius)
+				{
+					found.push_back(guestId);
+				}
+			}
+		}
+	}
+}
+
+/****************************************************************
+Returns the number of guests in the index.
+****************************************************************/
+
+int GuestIndex::count() const
+{
+	return m_count;
+}
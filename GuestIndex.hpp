@@ -0,0 +1,85 @@
+/*********************************************************************
+** Program name: GuestIndex.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the GuestIndex class.
+**				Used with the ThiefGame class to find guests by
+**				location without walking the room. The index keeps
+**				the guest id in every cell of the room, and splits
+**				the room into square regions that each keep a bucket
+**				of the guests inside them. Adding, removing and
+**				moving a guest only touch the guest's cell and its
+**				region's bucket. A query for the guests near a cell
+**				only looks at the regions that overlap the area
+**				asked for.
+*********************************************************************/
+
+#ifndef GUESTINDEX_HPP
+#define GUESTINDEX_HPP
+
+#include <vector>
+
+class GuestIndex {
+	public:
+		// returned in place of a guest id when there is no guest
+		static constexpr int NO_GUEST = -1;
+
+		// Constructor. The parameters are the number of rows
+		// and columns in the room.
+		GuestIndex(int rows, int cols);
+
+		// Adds the guest whose id is the first parameter to the
+		// cell at the given row and column. No return value.
+		void add(int guestId, int row, int col);
+
+		// Removes the guest whose id is the single parameter.
+		// Does nothing if the guest is not in the index. No
+		// return value.
+		void remove(int guestId);
+
+		// Moves the guest whose id is the first parameter to
+		// the cell at the given row and column. No return value.
+		void move(int guestId, int row, int col);
+
+		// Returns the id of the guest in the cell at the given
+		// row and column, or NO_GUEST if the cell has no guest.
+		int guestAt(int row, int col) const;
+
+		// Places the ids of every guest within the given number
+		// of steps (in any direction, diagonals counting as one
+		// step) of the given row and column in the last
+		// parameter. The list is cleared first. No return value.
+		void guestsNear(int row, int col, int radius,
+			std::vector<int> &found) const;
+
+		// Returns the number of guests in the index.
+		int count() const;
+
+	private:
+		// the width and height (in cells) of a region, as a
+		// shift. Regions are 4 x 4 cells.
+		static constexpr int REGION_SHIFT = 2;
+
+		// the size of the room and the number of region columns
+		int m_rows;
+		int m_cols;
+		int m_regionCols;
+
+		// the guest id in each cell (indexed by row * cols + col)
+		std::vector<int> m_cellGuest;
+		// the guest ids in each region
+		std::vector<std::vector<int>> m_regions;
+
+		// for each guest id: its cell (-1 if not in the index)
+		// and its position in its region's bucket
+		std::vector<int> m_guestCell;
+		std::vector<int> m_bucketSlot;
+
+		// the number of guests in the index
+		int m_count;
+
+		// returns the region holding the given cell
+		int regionOf(int cell) const;
+};
+
+#endif
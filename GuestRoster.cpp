@@ -0,0 +1,219 @@
+/*********************************************************************
+** Program name: GuestRoster.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the GuestRoster class.
+**				See GuestRoster.hpp for the roster file format.
+*********************************************************************/
+
+#include "GuestRoster.hpp"
+#include <cstdlib>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "NameInterner.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// the roster used when the roster file cannot be read
+static const char DEFAULT_ROSTER[] =
+	"Bill M\n" "Charles M\n" "Ethan M\n" "Sebastian M\n" "Xavier M\n"
+	"Zachary M\n" "Reuben M\n" "Wesley M\n" "Maximus M\n" "Alec M\n"
+	"Ophelia F\n" "Violet F\n" "Isabella F\n" "Penelope F\n" "Nora F\n"
+	"Hannah F\n" "Lola F\n" "Georgia F\n" "Jasmine F\n" "Diana F\n";
+
+/****************************************************************
+Constructor. Maps the roster file whose path is the single
+parameter and reads the guests from it. The built-in roster is
+used if the file cannot be mapped or holds no guests.
+****************************************************************/
+
+GuestRoster::GuestRoster(const char* path)
+	: m_map{ nullptr },
+	  m_mapSize{ 0 }
+{
+	int fd = open(path, O_RDONLY);
+	if (fd != -1)
+	{
+		struct stat info;
+		if (fstat(fd, &info) == 0 && info.st_size > 0)
+		{
+			void* map = mmap(nullptr, info.st_size, PROT_READ,
+				MAP_PRIVATE, fd, 0);
+			if (map != MAP_FAILED)
+			{
+				m_map = map;
+				m_mapSize = info.st_size;
+				parse(static_cast<const char*>(m_map), m_mapSize);
+			}
+		}
+		// the mapping stays valid once the file is closed
+		close(fd);
+	}
+
+	if (m_entries.empty())
+	{
+		parse(DEFAULT_ROSTER, sizeof(DEFAULT_ROSTER) - 1);
+	}
+
+	m_order.resize(m_entries.size());
+	for (std::size_t i = 0; i < m_order.size(); i++)
+	{
+		m_order[i] = i;
+	}
+}
+
+/****************************************************************
+Adds an entry for every guest line in the text. The first
+parameter is the text and the second parameter is its length.
+Each name is interned as a view into the text. Lines with no
+gender field are skipped. No return value.
+****************************************************************/
+
+void GuestRoster::parse(const char* text, std::size_t length)
+{
+	std::string_view rest{ text, length };
+	while (!rest.empty())
+	{
+		std::size_t lineEnd = rest.find('\n');
+		std::string_view line = rest.substr(0, lineEnd);
+		rest.remove_prefix(lineEnd == std::string_view::npos ?
+			rest.size() : lineEnd + 1);
+
+		// split off the name and gender fields. Anything after
+		// them is a future attribute.
+		std::string_view fields[2];
+		int numFields = 0;
+		std::size_t pos = 0;
+		while (numFields < 2)
+		{
+			pos = line.find_first_not_of(" \t\r", pos);
+			if (pos == std::string_view::npos)
+			{
+				break;
+			}
+			std::size_t fieldEnd = line.find_first_of(" \t\r", pos);
+			fields[numFields] = line.substr(pos, fieldEnd - pos);
+			numFields++;
+			pos = fieldEnd;
+		}
+
+		if (numFields < 2 || fields[0][0] == '#')
+		{
+			continue;
+		}
+
+		char gender = fields[1][0];
+		if (gender == 'M' || gender == 'm')
+		{
+			m_entries.push_back(Entry{ 
+				NameInterner::shared().intern(fields[0]), true });
+		}
+		else if (gender == 'F' || gender == 'f')
+		{
+			m_entries.push_back(Entry{ 
+				NameInterner::shared().intern(fields[0]), false });
+		}
+	}
+}
+
+/****************************************************************
+Returns the roster shared by all games. The roster file is read
+the first time the method is called.
+****************************************************************/
+
+GuestRoster& GuestRoster::shared()
+{
+	static GuestRoster roster(ROSTER_FILE);
+	return roster;
+}
+
+/****************************************************************
+Destructor. Unmaps the roster file if it was mapped.
+****************************************************************/
+
+GuestRoster::~GuestRoster()
+{
+	if (m_map != nullptr)
+	{
+		munmap(m_map, m_mapSize);
+	}
+}
+
+/****************************************************************
+Returns the number of guests in the roster.
+****************************************************************/
+
+int GuestRoster::size() const
+{
+	return m_entries.size();
+}
+
+/****************************************************************
+Returns the name id of the guest at the index passed as the
+parameter.
+****************************************************************/
+
+NameId GuestRoster::getNameId(int entry) const
+{
+	return m_entries[entry].name;
+}
+
+/****************************************************************
+Returns the name of the guest at the index passed as the
+parameter. The name points into the roster's string pool.
+****************************************************************/
+
+std::string_view GuestRoster::getName(int entry) const
+{
+	return NameInterner::shared().getText(m_entries[entry].name);
+}
+
+/****************************************************************
+Returns true if the guest at the index passed as the parameter
+is male and false otherwise.
+****************************************************************/
+
+bool GuestRoster::isMale(int entry) const
+{
+	return m_entries[entry].male;
+}
+
+/****************************************************************
+Chooses a number of different guests at random with a partial
+Fisher-Yates shuffle: each chosen guest is swapped into the next
+position at the front of the index array. The index array is not
+reset between calls since any order of it is a fair start. The
+single parameter is the number of guests wanted and the return
+value is the number chosen.
+****************************************************************/
+
+int GuestRoster::sample(int count)
+{
+	int numEntries = m_order.size();
+	if (count > numEntries)
+	{
+		count = numEntries;
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		int pick = i + rand() % (numEntries - i);
+		std::swap(m_order[i], m_order[pick]);
+	}
+
+	return count;
+}
+
+/****************************************************************
+Returns the index of the guest chosen in the position passed as
+the parameter by the last call to sample.
+****************************************************************/
+
+int GuestRoster::sampled(int position) const
+{
+	return m_order[position];
+}
@@ -0,0 +1,95 @@
+/*********************************************************************
+** Program name: GuestRoster.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the GuestRoster class.
+**				Holds every guest that can be invited to a party. The
+**				roster is read once from the guest roster file and
+**				shared by all games. The file is mapped into memory
+**				and used as the string pool for the guest names, so
+**				names are never copied: each name is interned (see
+**				NameInterner) as a view into the pool and guests
+**				refer to it by its name id. If the file cannot be
+**				read, a built-in roster is used instead.
+**				File format: one guest per line, made up of fields
+**				separated by spaces or tabs. The first field is the
+**				name and the second is the gender (M or F). Any
+**				further fields are left for future attributes and
+**				are ignored. Blank lines and lines starting with '#'
+**				are skipped.
+**				Guests are chosen for a party with a partial
+**				Fisher-Yates shuffle of an index array that is kept
+**				between games, so choosing n guests costs n swaps.
+*********************************************************************/
+
+#ifndef GUESTROSTER_HPP
+#define GUESTROSTER_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+#include "NameInterner.hpp"
+
+class GuestRoster {
+	private:
+		// a single guest in the roster
+		struct Entry {
+			NameId name;
+			bool male;
+		};
+
+		// the mapped roster file (nullptr if the built-in roster
+		// is used) and its size in bytes
+		void* m_map;
+		std::size_t m_mapSize;
+		// every guest in the roster, in file order
+		std::vector<Entry> m_entries;
+		// a permutation of the entry indexes. The first entries
+		// are the guests chosen by the last call to sample.
+		std::vector<int> m_order;
+
+		// Constructor. The single parameter is the path of the
+		// roster file to map.
+		GuestRoster(const char* path);
+
+		// Adds an entry for every guest line in the text passed
+		// as the parameters (the text and its length). The text
+		// must outlive the roster. No return value.
+		void parse(const char* text, std::size_t length);
+	public:
+		// the roster file read by the shared roster
+		static constexpr const char* ROSTER_FILE = "guests.txt";
+
+		// Returns the roster shared by all games. The roster file
+		// is read on the first call.
+		static GuestRoster& shared();
+
+		// the roster owns its mapping so it cannot be copied
+		GuestRoster(const GuestRoster&) = delete;
+		GuestRoster& operator=(const GuestRoster&) = delete;
+
+		// Destructor. Unmaps the roster file.
+		~GuestRoster();
+
+		// Returns the number of guests in the roster.
+		int size() const;
+
+		// Returns the name id / name / gender of the guest at the
+		// index passed as the parameter.
+		NameId getNameId(int entry) const;
+		std::string_view getName(int entry) const;
+		bool isMale(int entry) const;
+
+		// Chooses a number of different guests at random. The
+		// single parameter is the number of guests wanted. Returns
+		// the number chosen, which is less than asked for if the
+		// roster is too small. The chosen guests are then read with
+		// the sampled method.
+		int sample(int count);
+
+		// Returns the index of the guest chosen in the position
+		// passed as the parameter by the last call to sample.
+		int sampled(int position) const;
+};
+
+#endif
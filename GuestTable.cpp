@@ -0,0 +1,313 @@
+/*********************************************************************
+** Program name: GuestTable.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the GuestTable class.
+**				See GuestTable.hpp.
+*********************************************************************/
+
+#include "GuestTable.hpp"
+#include "GuestRoster.hpp"
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cctype>
+
+/****************************************************************
+Constructor. The table starts with no guests.
+****************************************************************/
+
+GuestTable::GuestTable()
+{
+}
+
+/****************************************************************
+Returns the bit for the letter passed as the parameter (of either
+case), or 0 if the character is not a letter.
+****************************************************************/
+
+unsigned int GuestTable::letterBit(char letter)
+{
+	int lower = tolower(static_cast<unsigned char>(letter));
+	if (lower < 'a' || lower > 'z')
+	{
+		return 0;
+	}
+	return 1u << (lower - 'a');
+}
+
+/****************************************************************
+Adds a guest to the table. The single parameter is the guest's
+index in the shared guest roster, which gives the name and gender.
+The letters of the name are worked out once here, and the guest is
+added to the bitsets of those letters and of their gender. The 
+guest starts unmet and not in a cell. Returns the new guest id.
+****************************************************************/
+
+int GuestTable::add(int rosterEntry)
+{
+	const GuestRoster &roster = GuestRoster::shared();
+	unsigned int letters = 0;
+	for (char letter : roster.getName(rosterEntry))
+	{
+		letters |= letterBit(letter);
+	}
+
+	int guestId = m_rosterEntry.size();
+	m_rosterEntry.push_back(rosterEntry);
+	m_nameId.push_back(roster.getNameId(rosterEntry));
+	m_flags.push_back(roster.isMale(rosterEntry) ? MALE : 0);
+	m_letters.push_back(letters);
+	m_cell.push_back(NO_CELL);
+
+	// the bitsets grow by a word every SET_BITS guests
+	if (guestId % SET_BITS == 0)
+	{
+		for (int letter = 0; letter < NUM_LETTERS; letter++)
+		{
+			m_letterSets[letter].push_back(0);
+		}
+		m_genderSets[0].push_back(0);
+		m_genderSets[1].push_back(0);
+	}
+	int word = guestId / SET_BITS;
+	std::uint64_t bit = std::uint64_t{ 1 } << (guestId % SET_BITS);
+	for (int letter = 0; letter < NUM_LETTERS; letter++)
+	{
+		if (letters & (1u << letter))
+		{
+			m_letterSets[letter][word] |= bit;
+		}
+	}
+	m_genderSets[roster.isMale(rosterEntry) ? 1 : 0][word] |= bit;
+	return guestId;
+}
+
+/****************************************************************
+Returns the number of guests in the table, including the guests
+that have left the party.
+****************************************************************/
+
+int GuestTable::size() const
+{
+	return m_rosterEntry.size();
+}
+
+/****************************************************************
+Returns the name id of the guest whose id is the single parameter.
+****************************************************************/
+
+NameId GuestTable::getNameId(int guestId) const
+{
+	return m_nameId[guestId];
+}
+
+/****************************************************************
+Returns the name of the guest whose id is the single parameter
+(it points into the guest roster).
+****************************************************************/
+
+std::string_view GuestTable::getName(int guestId) const
+{
+	return NameInterner::shared().getText(m_nameId[guestId]);
+}
+
+/****************************************************************
+Returns the index in the guest roster of the guest whose id is
+the single parameter.
+****************************************************************/
+
+int GuestTable::getRosterEntry(int guestId) const
+{
+	return m_rosterEntry[guestId];
+}
+
+/****************************************************************
+Returns the flags of the guest whose id is the single parameter.
+****************************************************************/
+
+unsigned char GuestTable::getFlags(int guestId) const
+{
+	return m_flags[guestId];
+}
+
+/****************************************************************
+Returns the letter bits of the name of the guest whose id is the
+single parameter.
+****************************************************************/
+
+unsigned int GuestTable::getLetters(int guestId) const
+{
+	return m_letters[guestId];
+}
+
+/****************************************************************
+Returns the cell of the guest whose id is the single parameter,
+or NO_CELL if the guest is not in the room.
+****************************************************************/
+
+int GuestTable::getCell(int guestId) const
+{
+	return m_cell[guestId];
+}
+
+/****************************************************************
+Returns true if the guest whose id is the single parameter is
+male.
+****************************************************************/
+
+bool GuestTable::isMale(int guestId) const
+{
+	return m_flags[guestId] & MALE;
+}
+
+/****************************************************************
+Returns true if the guest whose id is the single parameter has
+been met.
+****************************************************************/
+
+bool GuestTable::isMet(int guestId) const
+{
+	return m_flags[guestId] & MET;
+}
+
+/****************************************************************
+Returns true if the guest whose id is the single parameter has
+left the party.
+****************************************************************/
+
+bool GuestTable::hasLeft(int guestId) const
+{
+	return m_flags[guestId] & LEFT;
+}
+
+/****************************************************************
+Marks the guest whose id is the single parameter as met. No
+return value.
+****************************************************************/
+
+void GuestTable::setMet(int guestId)
+{
+	m_flags[guestId] |= MET;
+}
+
+/****************************************************************
+Sets the cell of a guest. The first parameter is the guest id and
+the second is the cell (as row * cols + col). No return value.
+****************************************************************/
+
+void GuestTable::setCell(int guestId, int cell)
+{
+	m_cell[guestId] = cell;
+}
+
+/****************************************************************
+Marks a guest as having left the party. The guest is no longer in
+a cell. The single parameter is the guest id. No return value.
+****************************************************************/
+
+void GuestTable::setLeft(int guestId)
+{
+	m_flags[guestId] |= LEFT;
+	m_cell[guestId] = NO_CELL;
+}
+
+/****************************************************************
+Finds the guests that match a filter. The first two parameters
+are a mask of the flags to check and the values they must have
+(ex. MALE | MET and MALE for the met male guests), the third is
+the letters the name must hold (see letterBit) and the found
+guest ids are placed in the last parameter (which is cleared
+first). Every guest is written to the end of the list and the
+length only grows when the guest matches, so the loop has no
+branches. No return value.
+****************************************************************/
+
+void GuestTable::select(unsigned char flagMask, unsigned char flags,
+	unsigned int letters, std::vector<int> &found) const
+{
+	int numGuests = m_flags.size();
+	found.resize(numGuests);
+	int numFound = 0;
+	for (int id = 0; id < numGuests; id++)
+	{
+		found[numFound] = id;
+		numFound += ((m_flags[id] & flagMask) == flags)
+			& ((m_letters[id] & letters) == letters);
+	}
+	found.resize(numFound);
+}
+
+/****************************************************************
+Returns the number of guests that match a filter. The parameters
+are the same as the first three of select.
+****************************************************************/
+
+int GuestTable::count(unsigned char flagMask, unsigned char flags,
+	unsigned int letters) const
+{
+	int numGuests = m_flags.size();
+	int numFound = 0;
+	for (int id = 0; id < numGuests; id++)
+	{
+		numFound += ((m_flags[id] & flagMask) == flags)
+			& ((m_letters[id] & letters) == letters);
+	}
+	return numFound;
+}
+
+/****************************************************************
+Returns the bitset over the guests (a bit for each guest id) of
+the guests whose name holds the letter whose index is the single
+parameter (0 for 'a' to 25 for 'z').
+****************************************************************/
+
+const std::vector<std::uint64_t>& GuestTable::withLetter(int letter) const
+{
+	return m_letterSets[letter];
+}
+
+/****************************************************************
+Returns the bitset over the guests of the male guests if the 
+single parameter is true, and of the female guests otherwise.
+****************************************************************/
+
+const std::vector<std::uint64_t>& GuestTable::withGender(bool male) const
+{
+	return m_genderSets[male ? 1 : 0];
+}
+
+/****************************************************************
+Returns the number of words in a bitset over the guests.
+****************************************************************/
+
+int GuestTable::numWords() const
+{
+	return m_genderSets[0].size();
+}
+
+/****************************************************************
+Clears from a bitset over the guests the guests whose name does
+not hold every letter in the first parameter (a bit for each 
+letter, see letterBit). The bitset is the last parameter and must
+have numWords words. Each letter costs a single AND of bitsets. 
+No return value.
+****************************************************************/
+
+void GuestTable::keepLetters(unsigned int letters,
+	std::vector<std::uint64_t> &guests) const
+{
+	int numSetWords = guests.size();
+	for (int letter = 0; letter < NUM_LETTERS; letter++)
+	{
+		if (!(letters & (1u << letter)))
+		{
+			continue;
+		}
+		const std::vector<std::uint64_t> &letterSet = m_letterSets[letter];
+		for (int word = 0; word < numSetWords; word++)
+		{
+			guests[word] &= letterSet[word];
+		}
+	}
+}
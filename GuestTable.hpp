@@ -0,0 +1,142 @@
+/*********************************************************************
+** Program name: GuestTable.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the GuestTable class.
+**				Holds every guest of a party as a structure of
+**				arrays indexed by guest id: the guest's index in the
+**				guest roster, the name id of the guest's name (see
+**				NameInterner), a byte of flags (male,
+**				met and left the party), the letters in the name (as
+**				a bit for each letter) and the cell the guest is in.
+**				Guests stay in the table after they leave so notes
+**				about them can still be read.
+**				The Person spaces in the room only hold a guest id
+**				and read everything else from the table. Questions
+**				about many guests at once (ex. "the unmet female
+**				guests whose name contains 'e'") are a single pass
+**				over the flag and letter arrays with no branches,
+**				which stays fast for parties of thousands of guests.
+**				The table also keeps a bitset over the guests (a bit
+**				for each guest id) for each letter, holding the
+**				guests whose name contains it, and one for each
+**				gender. Finding the guests that fit a clue (ex. "the
+**				thief's name contains the letter 'x'") is then a
+**				single AND of bitsets.
+*********************************************************************/
+
+#ifndef GUESTTABLE_HPP
+#define GUESTTABLE_HPP
+
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include "NameInterner.hpp"
+
+class GuestTable {
+	public:
+		// the flags held for each guest
+		static constexpr unsigned char MALE = 1 << 0;
+		static constexpr unsigned char MET = 1 << 1;
+		static constexpr unsigned char LEFT = 1 << 2;
+
+		// the cell of a guest that is not in the room
+		static constexpr int NO_CELL = -1;
+
+		// the number of letters, and the number of guests in each
+		// word of a bitset over the guests
+		static constexpr int NUM_LETTERS = 26;
+		static constexpr int SET_BITS = 64;
+
+		// Constructor. The table starts with no guests.
+		GuestTable();
+
+		// Adds a guest to the table. The single parameter is the
+		// guest's index in the guest roster. Returns the guest
+		// id of the new guest.
+		int add(int rosterEntry);
+
+		// Returns the number of guests in the table (including
+		// the guests that have left).
+		int size() const;
+
+		// Returns the name id / name / roster index / flags /
+		// letter bits / cell (as row * cols + col) of the guest
+		// whose id is the single parameter.
+		NameId getNameId(int guestId) const;
+		std::string_view getName(int guestId) const;
+		int getRosterEntry(int guestId) const;
+		unsigned char getFlags(int guestId) const;
+		unsigned int getLetters(int guestId) const;
+		int getCell(int guestId) const;
+
+		// Returns true if the guest whose id is the single
+		// parameter is male / has been met / has left.
+		bool isMale(int guestId) const;
+		bool isMet(int guestId) const;
+		bool hasLeft(int guestId) const;
+
+		// Marks the guest whose id is the single parameter as met.
+		// No return value.
+		void setMet(int guestId);
+
+		// Sets the cell of the guest whose id is the first
+		// parameter. No return value.
+		void setCell(int guestId, int cell);
+
+		// Marks the guest whose id is the single parameter as
+		// having left the party (the guest is no longer in a
+		// cell). No return value.
+		void setLeft(int guestId);
+
+		// Finds every guest whose flags, once masked by the first
+		// parameter, equal the second parameter and whose name
+		// holds every letter in the third parameter (a bit for
+		// each letter, see letterBit). The guest ids found are
+		// placed in the last parameter. No return value.
+		void select(unsigned char flagMask, unsigned char flags,
+			unsigned int letters, std::vector<int> &found) const;
+
+		// Returns the number of guests that select would find for
+		// the same parameters.
+		int count(unsigned char flagMask, unsigned char flags,
+			unsigned int letters) const;
+
+		// Returns the bitset over the guests of the guests whose
+		// name holds the letter with the index passed as the
+		// parameter (0 for 'a').
+		const std::vector<std::uint64_t>& withLetter(int letter) const;
+
+		// Returns the bitset over the guests of the male guests
+		// (if the parameter is true) or the female guests.
+		const std::vector<std::uint64_t>& withGender(bool male) const;
+
+		// Returns the number of words in a bitset over the guests.
+		int numWords() const;
+
+		// Clears from the bitset over the guests passed as the 
+		// last parameter every guest whose name doesn't hold all
+		// of the letters in the first parameter (a bit for each 
+		// letter, see letterBit). No return value.
+		void keepLetters(unsigned int letters,
+			std::vector<std::uint64_t> &guests) const;
+
+		// Returns the bit for a letter (of either case), or 0 if
+		// the character is not a letter.
+		static unsigned int letterBit(char letter);
+
+	private:
+		// the guests, indexed by guest id
+		std::vector<int> m_rosterEntry;
+		std::vector<NameId> m_nameId;
+		std::vector<unsigned char> m_flags;
+		std::vector<unsigned int> m_letters;
+		std::vector<int> m_cell;
+
+		// the bitsets over the guests for each letter and for 
+		// each gender (index 0 for female and 1 for male)
+		std::vector<std::uint64_t> m_letterSets[NUM_LETTERS];
+		std::vector<std::uint64_t> m_genderSets[2];
+};
+
+#endif
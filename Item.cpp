@@ -0,0 +1,56 @@
+/*********************************************************************
+** Program name: Item.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the item registry.
+**				Holds the registry entry for every item that can be
+**				carried in the backpack. See Item.hpp.
+*********************************************************************/
+
+#include "Item.hpp"
+#include "Space.hpp"
+#include "Floor.hpp"
+#include "Person.hpp"
+#include "EventStream.hpp"
+
+/****************************************************************
+Use condition for fireworks. Returns true if the space passed as
+the parameter is an empty floor space.
+****************************************************************/
+
+static bool onFloor(const Space* curSpace)
+{
+	return curSpace->getType() == Floor::statType();
+}
+
+/****************************************************************
+Use condition for truth candy bars. Returns true if the space
+passed as the parameter holds a guest.
+****************************************************************/
+
+static bool onGuest(const Space* curSpace)
+{
+	return curSpace->getType() == Person::statType();
+}
+
+// the registry, in the same order as the ItemId enum
+static const ItemType ITEM_TYPES[NUM_ITEMS] = {
+	// FIREWORKS_ITEM_ID
+	{ "Fireworks", "Use fireworks", MSG_FIREWORKS_ADDED, onFloor,
+	  MSG_FIREWORKS_CANT_USE, MSG_FIREWORKS_USED,
+	  EventStream::FIREWORKS_ITEM },
+	// TRUTH_CANDY_ITEM_ID
+	{ "Truth Candy Bar", "Use Truth Candy Bar", MSG_TRUTH_CANDY_ADDED,
+	  onGuest, MSG_TRUTH_CANDY_CANT_USE, MSG_NONE,
+	  EventStream::TRUTH_CANDY_ITEM }
+};
+
+/****************************************************************
+Returns the registry entry for the item whose id is the single
+parameter.
+****************************************************************/
+
+const ItemType& getItemType(ItemId id)
+{
+	return ITEM_TYPES[id];
+}
@@ -0,0 +1,52 @@
+/*********************************************************************
+** Program name: Item.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the item registry.
+**				Every item that can be carried in the backpack has
+**				an id and an entry in a static registry. The entry
+**				holds the name and menu option of the item, the ids
+**				of the messages said for it, the condition for
+**				using it (the kind of space the player must be on)
+**				and its EventStream item number. The effect of using
+**				an item is handled by the ThiefGame class, which
+**				keeps a handler for each item id. Adding a new item
+**				means adding an id, a registry entry and a handler.
+*********************************************************************/
+
+#ifndef ITEM_HPP
+#define ITEM_HPP
+
+#include "Space.hpp"
+#include "Messages.hpp"
+
+// ids of every item (also the bit of the item in the backpack)
+enum ItemId {
+	FIREWORKS_ITEM_ID = 0,
+	TRUTH_CANDY_ITEM_ID,
+	NUM_ITEMS
+};
+
+// the registry entry for an item
+struct ItemType {
+	// the name of the item
+	const char* name;
+	// the backpack menu option for using the item
+	const char* useOption;
+	// said when the item is placed in the backpack
+	MsgId addedMsg;
+	// returns true if the item can be used on the given space
+	bool (*canUse)(const Space* curSpace);
+	// said when the item cannot be used on the player's space
+	MsgId cantUseMsg;
+	// said when the item is used, before its effect (MSG_NONE if
+	// the effect says everything)
+	MsgId usedMsg;
+	// the item number used by EventStream ITEM events
+	int eventNumber;
+};
+
+// returns the registry entry for the item with the given id
+const ItemType& getItemType(ItemId id);
+
+#endif
@@ -12,7 +12,7 @@
 
 #include "Launcher.hpp"
 #include "Menu.hpp"
-#include <iostream>
+#include "Messages.hpp"
 #include <string>
 #include <vector>
 
@@ -49,14 +49,13 @@ std::string Launcher::statType()
 }
 
 /****************************************************************
-Prints a single character to the console representing the
-Stereo space. The method takes no parameters and has no return 
-value.
+Returns the single character that represents the Launcher
+space on the map. The method takes no parameters.
 ****************************************************************/
 
-void Launcher::printSpace() const
+char Launcher::getSymbol() const
 {
-	std::cout << "L"; 
+	return 'L';
 }
 
 /****************************************************************
@@ -92,20 +91,19 @@ int Launcher::chooseDirection() const
 	};
 	static const Menu directionMenu(dirChoices);
 
-	std::cout << "\nYou are standing on the launcher. Please "
-		<< "choose the direction for your launch.\n";
+	say(Message{ MSG_LAUNCHER_CHOICE });
 
 	return directionMenu.chooseOption();	
 }
 
 /****************************************************************
-Returns information related to the Launcher as a string. Given that
+Returns information related to the Launcher as a Fact. Given that
 Launcher spaces do not contain any information, the method returns
-an empty string.
+an empty Fact.
 ****************************************************************/
 
-std::string Launcher::information() 
+Fact Launcher::information() 
 {
-	return "";	
+	return Fact();	
 }
 
@@ -14,6 +14,7 @@
 #define LAUNCHER_HPP
 
 #include "Space.hpp"
+#include "Fact.hpp"
 #include <string>
 
 class Launcher : public Space {
@@ -34,9 +35,9 @@ class Launcher : public Space {
 		// object instance.
 		static std::string statType();
 
-		// Prints a single character to the console
-		// representing the Launcher space.
-		virtual void printSpace() const override;
+		// Returns the single character that represents
+		// the Launcher space on the map.
+		virtual char getSymbol() const override;
 
 		// Performs an event related to the Launcher
 		// and returns a string representing the
@@ -52,8 +53,8 @@ class Launcher : public Space {
 		int chooseDirection() const;
 
 		// Returns information related to the Stereo
-		// as a string. No parameters.
-		virtual std::string information() override;	
+		// as a Fact. No parameters.
+		virtual Fact information() override;	
 };
 
 #endif
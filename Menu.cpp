@@ -19,7 +19,11 @@
 **		* Added November 20, 2019 - the changeOption method which
 **		allows individual options in the menu to be changed.
 **		* Added December 2, 2019 - the deleteLast method which
-**		deletes the last option in the menu. 
+**		deletes the last option in the menu.
+**		* Added - options can have a one letter command which
+**		can be typed instead of the option number. The options
+**		are not printed when the choice is already queued from
+**		an earlier command line. 
 *********************************************************************/
 
 #include "Menu.hpp"
@@ -27,6 +31,7 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <cctype>
 
 /***********************************************************************
 Default constructor for a Menu object. The constructor does not take 
@@ -42,6 +47,8 @@ parameter are added to the menu.
 Menu::Menu(std::vector<std::string> ops)
 {
 	options = ops;
+	keys.assign(ops.size(), ' ');
+	render();
 }
 
 /***********************************************************************
@@ -62,6 +69,21 @@ last option).
 void Menu::addOption(std::string op)
 {
 	options.push_back(op);
+	keys += ' ';
+	renderOption(options.size() - 1);
+}
+
+/***********************************************************************
+Adds the value of the string parameter as an option to the end of the
+menu. The option can also be chosen by typing the one letter command 
+passed as the second parameter.
+***********************************************************************/
+
+void Menu::addOption(std::string op, char key)
+{
+	options.push_back(op);
+	keys += static_cast<char>(tolower(static_cast<unsigned char>(key)));
+	renderOption(options.size() - 1);
 }
 
 /***********************************************************************
@@ -73,7 +95,11 @@ index in the parameter (from lowest to highest).
 void Menu::addOption(std::vector<std::string> ops)
 {
 	for (std::string op : ops)
+	{
 		options.push_back(op);
+		keys += ' ';
+		renderOption(options.size() - 1);
+	}
 }
 
 /***********************************************************************
@@ -87,13 +113,14 @@ returns true otherwise.
 
 bool Menu::changeOption(int opVal, std::string op)
 {
-	if (opVal < 1 || opVal > options.size())
+	if (opVal < 1 || opVal > static_cast<int>(options.size()))
 	{
 		return false;
 	}
 	else
 	{
 		options[opVal - 1] = op;
+		render();
 		return true;
 	}	
 }
@@ -106,6 +133,8 @@ the size of the vector member variable options will be 0).
 void Menu::clearMenu()
 {
 	options.clear();
+	keys.clear();
+	rendered.clear();
 }
 
 /***********************************************************************
@@ -115,7 +144,9 @@ number of options available (the number selected by the user is the
 number returned by this function, so the return value for the first 
 option being selected will be 1 rather than 0). The function returns
 -1 if there are no options currently in the menu (and there are no 
-prompts to the user).
+prompts to the user). Options with a one letter command can also be
+chosen by typing the command. If a valid choice is already queued from
+an earlier command line, it is used without printing the options.
 ***********************************************************************/
 
 int Menu::chooseOption() const
@@ -123,18 +154,87 @@ int Menu::chooseOption() const
 	// return -1 if no options in menu
 	if (options.size() == 0)
 		return -1;
+
+	int queued = 0;
+	if (queuedOption(queued))
+		return queued;
+
+	printOptions();
+	return readOption();
+}
+
+/***********************************************************************
+Takes the choice from the queued commands of an earlier command line
+without printing the menu. If a valid choice was queued, it is stored in
+the parameter and true is returned. Otherwise false is returned.
+***********************************************************************/
+
+bool Menu::queuedOption(int &choice) const
+{
+	if (options.size() == 0)
+		return false;
+	return queuedChoice(1, options.size(), keys, choice);
+}
+
+/***********************************************************************
+Prints the prompt and every option of the menu. The method takes no 
+parameters and has no return value.
+***********************************************************************/
+
+void Menu::printOptions() const
+{
 	std::cout << "Please select one of the options below.\n"
 		  << "To select an option, type the number next to the "
-		  << "option and press ENTER.\n";
-	int opNum = 1;
-	while (opNum <= options.size())
+		  << "option and press ENTER.\n"
+		  << rendered;
+}
+
+/***********************************************************************
+Reads the user's choice without printing the menu and returns the number
+of the option selected (the same values as chooseOption). The function
+returns -1 if there are no options currently in the menu.
+***********************************************************************/
+
+int Menu::readOption() const
+{
+	if (options.size() == 0)
+		return -1;
+	return choiceValid(1, options.size(), keys);
+}
+
+/***********************************************************************
+Rebuilds the printed text of the options. Each option is printed on its
+own line (see renderOption). Only needed when an option is changed or 
+deleted, since added options are appended to the printed text. The method
+takes no parameters and has no return value.
+***********************************************************************/
+
+void Menu::render()
+{
+	rendered.clear();
+	for (std::size_t i = 0; i < options.size(); i++)
 	{
-		std::cout << "(" << opNum << ") " << options[opNum - 1]
-			  << "\n";
-		opNum++;
+		renderOption(i);
 	}
+}
 
-	return intValid(1, options.size());
+/***********************************************************************
+Adds the printed line of the option whose index is passed as the parameter
+to the end of the printed text: its number in parentheses followed by the
+option text (and the one letter command in brackets, if the option has 
+one). No return value.
+***********************************************************************/
+
+void Menu::renderOption(int ind)
+{
+	rendered += "(" + std::to_string(ind + 1) + ") " + options[ind];
+	if (keys[ind] != ' ')
+	{
+		rendered += " [";
+		rendered += keys[ind];
+		rendered += "]";
+	}
+	rendered += "\n";
 }
 
 /***********************************************************************
@@ -145,4 +245,6 @@ and has no return value.
 void Menu::deleteLast()
 {
 	options.pop_back();
+	keys.pop_back();
+	render();
 }
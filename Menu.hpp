@@ -20,6 +20,16 @@
 **		allows individual options in the menu to be changed.
 **		* Added December 2, 2019 - the deleteLast method which
 **		deletes the last option in the menu.
+**		* Added - options can have a one letter command which
+**		can be typed instead of the option number. The options
+**		are not printed when the choice is already queued from
+**		an earlier command line.
+**		* Added - the printed text of the options is built when
+**		the options change, rather than each time the menu is
+**		shown.
+**		* Added - the queuedOption, printOptions and readOption
+**		methods which split chooseOption into its steps so the
+**		caller can act between printing and reading.
 *********************************************************************/
 
 #ifndef MENU_HPP
@@ -32,6 +42,17 @@ class Menu {
 	private:
 		// holds the options in the menu
 		std::vector<std::string> options;
+		// holds the one letter command for each option (a
+		// space if the option has no command)
+		std::string keys;
+		// holds the options as they are printed by chooseOption
+		std::string rendered;
+
+		// rebuilds the printed text of the options
+		void render();
+		// adds the printed line of a single option (given by its
+		// index) to the end of the printed text
+		void renderOption(int ind);
 	public:
 		// default constructor
 		Menu();
@@ -46,6 +67,11 @@ class Menu {
 		// adds a single option to the menu
 		void addOption(std::string op);
 
+		// adds a single option to the menu that can also be
+		// chosen by typing the one letter command passed as
+		// the second parameter
+		void addOption(std::string op, char key);
+
 		// adds all options in the vector to the menu
 		void addOption(std::vector<std::string> ops);	
 
@@ -62,6 +88,18 @@ class Menu {
 		// and returns the numeric value of the option selected
 		int chooseOption() const;
 
+		// takes the choice from the queued commands without
+		// printing the menu. Returns true and stores the choice
+		// in the parameter if a valid choice was queued.
+		bool queuedOption(int &choice) const;
+
+		// prints the prompt and the options of the menu
+		void printOptions() const;
+
+		// reads the user's choice without printing the menu and
+		// returns the numeric value of the option selected
+		int readOption() const;
+
 		// deletes the last option in the menu
 		void deleteLast();	
 };
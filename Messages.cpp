@@ -0,0 +1,427 @@
+/*********************************************************************
+** Program name: Messages.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the game's message table.
+**				All of the narrative text of the Find the Thief game
+**				is held once in a static table. A piece of narrative
+**				(a Message) is just the id of its text along with the
+**				values for any slots in the text, so messages are 
+**				cheap to store in the notepad and are only turned
+**				into text when they are printed. See Messages.hpp 
+**				for the list of slots.
+*********************************************************************/
+
+#include "Messages.hpp"
+#include "Item.hpp"
+#include <string>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <iostream>
+#include "NameInterner.hpp"
+
+// the text of every message, in the same order as the MsgId enum
+static const char* const MESSAGE_TEXT[NUM_MESSAGES] = {
+	// MSG_NONE
+	"",
+	// MSG_WELCOME
+	"\nWelcome to the Find the Thief Game!\n",
+	// MSG_GAME_INFO
+	"\nYou are at a party and realize that someone has stolen your "
+	"wallet.\nYou need to figure out who the thief is and call the police "
+	"before\nthe party is over. You need to guess the identity of the "
+	"thief correctly\nthe first time because the thief will leave if the "
+	"police arrive to\nquestion someone else. The party ends at {time}, "
+	"so you must\ncall the police before the party is over. Meet the "
+	"guests of\nthe party, pick up clues, and use items in the room to "
+	"help find\nthe thief.\n",
+	// MSG_ACCOMPLICE_INFO
+	"\nThe thief did not work alone tonight: {count} of the guests were in "
+	"on it. The\nclues each describe one of them, and you must name all "
+	"of them to the police.\n",
+	// MSG_MAP_INFO
+	"\nFor each turn of the game you will be shown a map of the room. The "
+	"symbols on\nthe map have the following meanings:\n",
+	// MSG_NOTE_INFO
+	"\nAll of this information is also written in your notepad for "
+	"reference.\n\n",
+	// MSG_COMMAND_INFO
+	"Menu options shown with a letter can be chosen by typing that "
+	"letter.\nSeveral choices can be typed on one line when it starts "
+	"with a letter, for\nexample 'm r' moves right and 'b 2 3' calls the "
+	"police about your third\ncontact.\n",
+	// MSG_SYMBOL_PLAYER
+	"* - your location in the room",
+	// MSG_SYMBOL_PERSON
+	"P - a person that you have not yet met",
+	// MSG_SYMBOL_FIREWORKS
+	"F - a box of fireworks. You can move to this box to pick up "
+	"fireworks",
+	// MSG_SYMBOL_CLUE
+	"C - a clue. This will give you a hint regarding the identity of "
+	"the thief",
+	// MSG_SYMBOL_TRUTH_CANDY
+	"T - a box of truth candy bars. You can move to this box to pick up "
+	"a truth\ncandy bar",
+	// MSG_SYMBOL_STEREO
+	"S - a stereo. You can play songs on the stereo that have different "
+	"effects on\nthe party",
+	// MSG_SYMBOL_LAUNCHER
+	"L - a launcher. Can be used to quickly launch yourself to other "
+	"parts of the\nroom",
+	// MSG_SYMBOL_MET
+	"a, b, c, ... - lower case letters represent the first letters of "
+	"the names of\npeople that you have already met",
+	// MSG_MET_GUEST
+	"I met {name}. {name} is {gender}.",
+	// MSG_GUEST_LEFT
+	"{name} has left the party.",
+	// MSG_UNMET_GUEST_LEFT
+	"A guest you did not meet has left the party.",
+	// MSG_GUESTS_FLEE
+	"\n{count} of the guests flee the party:\n",
+	// MSG_HELLO_1
+	"{name}: Nice to meet you!\n",
+	// MSG_HELLO_2
+	"{name}: Hey, how's it going?\n",
+	// MSG_HELLO_3
+	"{name}: Fun party, huh? Pleasure to meet you.\n",
+	// MSG_HELLO_4
+	"{name}: What's up? Want to be friends?\n",
+	// MSG_HELLO_AGAIN_1
+	"{name}: Nice to see you again.\n",
+	// MSG_HELLO_AGAIN_2
+	"{name}: Gosh, leave me alone.\n",
+	// MSG_HELLO_AGAIN_3
+	"{name}: Woaaah, you look familiar..\n",
+	// MSG_HELLO_AGAIN_4
+	"{name}: Long time no see!\n",
+	// MSG_CLUE_FOUND
+	"You pick up a slip of paper that contains the following note...\n",
+	// MSG_CLUE_GENDER
+	"The thief is {gender}.\n",
+	// MSG_CLUE_LETTER
+	"The thief's name contains the letter '{letter}'.\n",
+	// MSG_CLUE_GENDER_NOTE
+	"Clue: The thief is {gender}.",
+	// MSG_CLUE_LETTER_NOTE
+	"Clue: The thief's name contains the letter '{letter}'.",
+	// MSG_GROUP_GENDER
+	"One of the culprits is {gender}.\n",
+	// MSG_GROUP_LETTER
+	"One of the culprits has the letter '{letter}' in their name.\n",
+	// MSG_GROUP_GENDER_NOTE
+	"Clue: One of the culprits is {gender}.",
+	// MSG_GROUP_LETTER_NOTE
+	"Clue: One of the culprits has the letter '{letter}' in their name.",
+	// MSG_ITEM_ALREADY_HELD
+	"\nYou already have the {item} in your backpack.\n",
+	// MSG_BACKPACK_FULL
+	"\nYour backpack is full and you are not able to add the {item}.\n",
+	// MSG_FIREWORKS_FOUND
+	"\nYou open up a box on the ground and pull out fireworks.\n",
+	// MSG_FIREWORKS_ADDED
+	"\nYou place the fireworks into your backpack.\n",
+	// MSG_FIREWORKS_CANT_USE
+	"\nYou could not set off the fireworks. The fireworks need to be set "
+	"off on empty\nfloor space.\n",
+	// MSG_FIREWORKS_USED
+	"\nYou set off the fireworks. There is a beautiful display of vibrant "
+	"colors.\nMiraculously, nothing in the room sets on fire.\n",
+	// MSG_FIREWORKS_EFFECT
+	"\nThe fireworks excite the guests and the party will last longer!\n",
+	// MSG_TRUTH_CANDY_FOUND
+	"\nYou open up a box on the ground and pull out a Truth Candy Bar.\n"
+	"You read the label on the back:\nWARNING: This candy bar will cause "
+	"the consumer to be completely honest for up\nto an hour. Politicians "
+	"should only consume in private settings.\n",
+	// MSG_TRUTH_CANDY_ADDED
+	"\nYou place the Truth Candy Bar into your backpack.\n",
+	// MSG_TRUTH_CANDY_CANT_USE
+	"\nYou must be on a space with a guest to feed them a truth bar.\n",
+	// MSG_TRUTH_OFFER
+	"\nYou: Here, try out this candy bar, it's really good!\n"
+	"{name}: Thanks! ... Mmmm this is tasty.. But it is strange that "
+	"you're carrying\ncandy around at a party. And you've got a poor "
+	"sense of style, a weird\nlooking haircut, and a..\n"
+	"You: OKAY, thanks.. Appreciate the honesty. I have a question, did "
+	"you steal my\nwallet tonight?\n{name}: ",
+	// MSG_TRUTH_ADMIT
+	"Yes, I did steal your wallet!\n",
+	// MSG_TRUTH_DENY
+	"No, I did not steal your wallet!\n",
+	// MSG_TRUTH_ADMIT_NOTE
+	"{name} revealed that {he} stole your wallet.",
+	// MSG_TRUTH_DENY_NOTE
+	"{name} revealed that {he} did not steal your wallet.",
+	// MSG_STEREO_BROKEN
+	"The power cord to the stereo is torn to shreds and is no longer "
+	"functional.\n",
+	// MSG_STEREO_CHOICE
+	"\nThere are two song options on the stereo; make your pick!\n",
+	// MSG_STEREO_BAD_MUSIC
+	"You play your favorite Lizzo song. You raise the volume to a "
+	"deafening blare!\nA number of guests are alarmed and rapidly flee "
+	"from the party.\nA particularly affected guest lets out a howl of "
+	"existential terror.\nThe thief has a poor taste in music and stays "
+	"despite the cacophony.\nOne of the traumatized guests tears apart "
+	"the power cord to the stereo in a fit\nof hysteria before exiting "
+	"the event.\n",
+	// MSG_STEREO_GOOD_MUSIC
+	"You play Who Let the Dogs Out by Baha Men.\nThe guests are at once "
+	"stunned and overjoyed to hear a musical composition of\nsuch "
+	"artistic genius. The party quickly erupts into a chaotic frenzy of "
+	"primal\necstasy. As the song ends, a guest rabidly tears apart the "
+	"power cord to the\nstereo exclaiming that it would be disrespectful "
+	"to play any other music\nfollowing such a phenomenal display of "
+	"unmatched artistry.\nThe party applauds in unanimous agreement.\n",
+	// MSG_EXODUS_MAP
+	"\nNew map of the room following the exodus:\n",
+	// MSG_PARTY_EXCITED
+	"The excitement of the guests causes the party to last longer!\n",
+	// MSG_LAUNCHER_CHOICE
+	"\nYou are standing on the launcher. Please choose the direction for "
+	"your launch.\n",
+	// MSG_LAUNCH_CRASH
+	"\nYou fly {direction} across the room and slam into the wall!\n",
+	// MSG_LAUNCH_MAP
+	"\nAn updated map of the room:\n",
+	// MSG_TIME
+	"\nCurrent time: {time}\n",
+	// MSG_NEW_END_TIME
+	"The new party end time is: {time}",
+	// MSG_POLICE_ALREADY_CALLED
+	"\nYou have already called the police and they are on their way.\n",
+	// MSG_NO_CONTACTS
+	"\nYou put your phone back in your backpack as you realize you "
+	"haven't met anyone\nat the party yet (and therefore won't have any "
+	"guess for the identity of the\nthief).\n",
+	// MSG_TOO_FEW_CONTACTS
+	"\nYou put your phone back in your backpack as you realize you "
+	"haven't met enough\nguests yet to name all {count} culprits.\n",
+	// MSG_POLICE_DIAL
+	"\nDialing 9-1-1....\nOperator: 9-1-1 operator. What is your "
+	"emergency?\nYou: I am at a party and someone has stolen my wallet.\n"
+	"Operator: Do you know who stole the wallet?\n",
+	// MSG_CHOOSE_THIEF
+	"\nYou must guess who at the party stole your wallet. Choose from one "
+	"of the guests below.\n",
+	// MSG_FIND_THIEF
+	"\nYou must guess who at the party stole your wallet. Find the guest "
+	"by typing the start\nof their name.\n",
+	// MSG_CHOOSE_CULPRITS
+	"\nYou must name every guest who was in on the theft ({count} of "
+	"them). Choose\nthem one at a time from the guests below.\n",
+	// MSG_FIND_CULPRITS
+	"\nYou must name every guest who was in on the theft ({count} of "
+	"them). Find\nthem one at a time by typing the start of their name.\n",
+	// MSG_ALREADY_NAMED
+	"\nYou have already named {name}.\n",
+	// MSG_NAME_ANOTHER
+	"\nWho else was in on it?\n",
+	// MSG_GUESS_FIRST
+	"\nYou: I think that {name}",
+	// MSG_GUESS_NEXT
+	", {name}",
+	// MSG_GUESS_LAST
+	" and {name}",
+	// MSG_GUESS_THIEF_END
+	" stole my wallet!\nOperator: Okay, we will have a unit there "
+	"shortly.\n",
+	// MSG_GUESS_GROUP_END
+	" stole my wallet together!\nOperator: Okay, we will have a unit "
+	"there shortly.\n",
+	// MSG_LAST_MINUTE_CALL
+	"\nThe party is ending, so you call the police at the last minute!\n",
+	// MSG_NO_CALL_MADE
+	"\nYou decided against calling the police as you have no clue as to "
+	"who stole your wallet!\nThe thief leaves along with the rest of the "
+	"guests as the party ends.\n",
+	// MSG_POLICE_ARRIVE
+	"\nMinutes later, the police arrive at the party.\n",
+	// MSG_POLICE_ON_THE_WAY
+	"\nThe police will arrive at {time}. Stay close to the guest you "
+	"named until they get\nhere!\n",
+	// MSG_POLICE_HERE
+	"\nThe police arrive at the party.\n",
+	// MSG_THIEF_WATCHED
+	"\n{name} edges towards the door, but sees you watching and stays "
+	"put.\n",
+	// MSG_THIEF_ESCAPED
+	"\n{name} slips out of the party before the police arrive! {He} "
+	"gets away with\nyour wallet.\n",
+	// MSG_GAME_WIN
+	"\nThe police interrogate {name} and discover that {he} is the "
+	"thief!\nCongratulations, you correctly identified the thief and "
+	"your wallet is returned to you!\n",
+	// MSG_GAME_LOSS
+	"\nThe real thief was {name}! {He} escapes as the police are busy "
+	"talking with\nthe wrong person!\n",
+	// MSG_CULPRIT_CAUGHT
+	"\nThe police interrogate {name} and discover that {he} was in on "
+	"the theft!",
+	// MSG_GROUP_WIN
+	"\nCongratulations, you caught every one of the culprits and your "
+	"wallet is returned\nto you!\n",
+	// MSG_GROUP_LOSS
+	"\nThe culprits escape as the police are busy talking with the "
+	"wrong people!\nThe guests in on the theft were:\n",
+	// MSG_CULPRIT_REVEALED
+	"- {name}",
+	// MSG_GAME_RESUMED
+	"\nYou are back at the party. It ends at {time}, so you must call the "
+	"police\nbefore then.\n",
+	// MSG_GAME_SAVED
+	"\nThe game has been saved. You slip out of the party for now.\n",
+	// MSG_SAVE_FAILED
+	"\nThe game could not be saved.\n"
+};
+
+// the stream messages are printed to, nullptr if messages are
+// not printed
+static std::ostream* messageSink = &std::cout;
+
+/***************************************************************************
+Writes a time (given as minutes since midnight) to the stream in the form
+used throughout the game, ex. 11:30PM or 01:05AM.
+***************************************************************************/
+
+static void writeTime(std::ostream &out, int minuteOfDay)
+{
+	static constexpr int MINS_PER_DAY{ 24 * 60 };
+	static constexpr int MINS_PER_HALF{ 12 * 60 };
+
+	minuteOfDay %= MINS_PER_DAY;
+	int hour = minuteOfDay / 60 % 12;
+	int min = minuteOfDay % 60;
+	if (hour == 0)
+	{
+		hour = 12;
+	}
+
+	out << (hour < 10 ? "0" : "") << hour << ":" 
+		<< (min < 10 ? "0" : "") << min
+		<< (minuteOfDay < MINS_PER_HALF ? "AM" : "PM");
+}
+
+/***************************************************************************
+Writes the text of the message to the stream passed as the first parameter.
+Each slot in the text (a slot name between braces) is replaced with the 
+matching value from the message.
+***************************************************************************/
+
+void writeMessage(std::ostream &out, const Message &msg)
+{
+	const char* text = MESSAGE_TEXT[msg.id];
+	while (*text != '\0')
+	{
+		const char* slot = strchr(text, '{');
+		if (slot == nullptr)
+		{
+			out << text;
+			return;
+		}
+		out.write(text, slot - text);
+
+		const char* slotEnd = strchr(slot, '}');
+		std::string slotName(slot + 1, slotEnd);
+		if (slotName == "name")
+		{
+			out << NameInterner::shared().getText(msg.name);
+		}
+		else if (slotName == "he")
+		{
+			out << (msg.male ? "he" : "she");
+		}
+		else if (slotName == "He")
+		{
+			out << (msg.male ? "He" : "She");
+		}
+		else if (slotName == "gender")
+		{
+			out << (msg.male ? "male" : "female");
+		}
+		else if (slotName == "letter")
+		{
+			out << msg.letter;
+		}
+		else if (slotName == "count")
+		{
+			out << msg.count;
+		}
+		else if (slotName == "time")
+		{
+			writeTime(out, msg.time);
+		}
+		else if (slotName == "item")
+		{
+			out << getItemType(static_cast<ItemId>(msg.item)).name;
+		}
+		else if (slotName == "direction")
+		{
+			static const char* const directions[]{ "up", "right", 
+				"down", "left" };
+			out << directions[msg.direction];
+		}
+		text = slotEnd + 1;
+	}
+}
+
+/***************************************************************************
+Returns the text of the message with its slots filled in.
+***************************************************************************/
+
+std::string formatMessage(const Message &msg)
+{
+	std::ostringstream text;
+	writeMessage(text, msg);
+	return text.str();
+}
+
+/***************************************************************************
+Writes the message to the message sink. Nothing is formatted if there is
+no sink.
+***************************************************************************/
+
+void say(const Message &msg)
+{
+	if (messageSink != nullptr)
+	{
+		writeMessage(*messageSink, msg);
+	}
+}
+
+/***************************************************************************
+Writes the message to the message sink followed by a newline. Used for the
+messages that are also lines of the notepad, which have no newline of their
+own. Nothing is formatted if there is no sink.
+***************************************************************************/
+
+void sayLine(const Message &msg)
+{
+	if (messageSink != nullptr)
+	{
+		writeMessage(*messageSink, msg);
+		*messageSink << "\n";
+	}
+}
+
+/***************************************************************************
+Sets the stream that messages are printed to. Passing nullptr turns the 
+printing of messages off.
+***************************************************************************/
+
+void setMessageSink(std::ostream* sink)
+{
+	messageSink = sink;
+}
+
+/***************************************************************************
+Returns true if messages are being printed and false otherwise.
+***************************************************************************/
+
+bool hasMessageSink()
+{
+	return messageSink != nullptr;
+}
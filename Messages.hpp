@@ -0,0 +1,182 @@
+/*********************************************************************
+** Program name: Messages.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the game's message table.
+**				All of the narrative text of the Find the Thief game
+**				is held once in a static table. A piece of narrative
+**				(a Message) is just the id of its text along with the
+**				values for any slots in the text, so messages are 
+**				cheap to store in the notepad and are only turned
+**				into text when they are printed. The slots are:
+**				{name} - the guest name (from the name id, so the
+**				name is only looked up when it is printed)
+**				{he}, {He} - he or she (from the male value)
+**				{gender} - male or female (from the male value)
+**				{letter} - a single letter
+**				{count} - a number
+**				{time} - a time such as 11:30PM (from minutes since
+**				midnight)
+**				{item} - the name of an item (from the item id)
+**				{direction} - up, right, down or left (from the
+**				direction value, 0 to 3 in that order)
+**				Messages are printed to the message sink, which is
+**				the console unless it is changed with setMessageSink.
+**				With no sink (ex. a game run by a bot) the messages
+**				are never formatted.
+*********************************************************************/
+
+#ifndef MESSAGES_HPP
+#define MESSAGES_HPP
+
+#include <string>
+#include <ostream>
+#include "NameInterner.hpp"
+
+// ids of every message in the table
+enum MsgId {
+	MSG_NONE = 0,
+	// game introduction
+	MSG_WELCOME,
+	MSG_GAME_INFO,
+	MSG_ACCOMPLICE_INFO,
+	MSG_MAP_INFO,
+	MSG_NOTE_INFO,
+	MSG_COMMAND_INFO,
+	// map symbols (these are also written in the notepad)
+	MSG_SYMBOL_PLAYER,
+	MSG_SYMBOL_PERSON,
+	MSG_SYMBOL_FIREWORKS,
+	MSG_SYMBOL_CLUE,
+	MSG_SYMBOL_TRUTH_CANDY,
+	MSG_SYMBOL_STEREO,
+	MSG_SYMBOL_LAUNCHER,
+	MSG_SYMBOL_MET,
+	// guests
+	MSG_MET_GUEST,
+	MSG_GUEST_LEFT,
+	MSG_UNMET_GUEST_LEFT,
+	MSG_GUESTS_FLEE,
+	// greetings from a guest being met (MSG_HELLO_*) or met again
+	// (MSG_HELLO_AGAIN_*), one of which is chosen at random
+	MSG_HELLO_1,
+	MSG_HELLO_2,
+	MSG_HELLO_3,
+	MSG_HELLO_4,
+	MSG_HELLO_AGAIN_1,
+	MSG_HELLO_AGAIN_2,
+	MSG_HELLO_AGAIN_3,
+	MSG_HELLO_AGAIN_4,
+	// clues, as read from the ground and as written in the notepad
+	MSG_CLUE_FOUND,
+	MSG_CLUE_GENDER,
+	MSG_CLUE_LETTER,
+	MSG_CLUE_GENDER_NOTE,
+	MSG_CLUE_LETTER_NOTE,
+	// clues about the group when there is more than one culprit
+	MSG_GROUP_GENDER,
+	MSG_GROUP_LETTER,
+	MSG_GROUP_GENDER_NOTE,
+	MSG_GROUP_LETTER_NOTE,
+	// items
+	MSG_ITEM_ALREADY_HELD,
+	MSG_BACKPACK_FULL,
+	MSG_FIREWORKS_FOUND,
+	MSG_FIREWORKS_ADDED,
+	MSG_FIREWORKS_CANT_USE,
+	MSG_FIREWORKS_USED,
+	MSG_FIREWORKS_EFFECT,
+	MSG_TRUTH_CANDY_FOUND,
+	MSG_TRUTH_CANDY_ADDED,
+	MSG_TRUTH_CANDY_CANT_USE,
+	// truth candy
+	MSG_TRUTH_OFFER,
+	MSG_TRUTH_ADMIT,
+	MSG_TRUTH_DENY,
+	MSG_TRUTH_ADMIT_NOTE,
+	MSG_TRUTH_DENY_NOTE,
+	// the stereo and the launcher
+	MSG_STEREO_BROKEN,
+	MSG_STEREO_CHOICE,
+	MSG_STEREO_BAD_MUSIC,
+	MSG_STEREO_GOOD_MUSIC,
+	MSG_EXODUS_MAP,
+	MSG_PARTY_EXCITED,
+	MSG_LAUNCHER_CHOICE,
+	MSG_LAUNCH_CRASH,
+	MSG_LAUNCH_MAP,
+	// time
+	MSG_TIME,
+	MSG_NEW_END_TIME,
+	// calling the police
+	MSG_POLICE_ALREADY_CALLED,
+	MSG_NO_CONTACTS,
+	MSG_TOO_FEW_CONTACTS,
+	MSG_POLICE_DIAL,
+	MSG_CHOOSE_THIEF,
+	MSG_FIND_THIEF,
+	MSG_CHOOSE_CULPRITS,
+	MSG_FIND_CULPRITS,
+	MSG_ALREADY_NAMED,
+	MSG_NAME_ANOTHER,
+	MSG_GUESS_FIRST,
+	MSG_GUESS_NEXT,
+	MSG_GUESS_LAST,
+	MSG_GUESS_THIEF_END,
+	MSG_GUESS_GROUP_END,
+	MSG_LAST_MINUTE_CALL,
+	MSG_NO_CALL_MADE,
+	// police
+	MSG_POLICE_ARRIVE,
+	MSG_POLICE_ON_THE_WAY,
+	MSG_POLICE_HERE,
+	MSG_THIEF_WATCHED,
+	MSG_THIEF_ESCAPED,
+	// end of the game
+	MSG_GAME_WIN,
+	MSG_GAME_LOSS,
+	MSG_CULPRIT_CAUGHT,
+	MSG_GROUP_WIN,
+	MSG_GROUP_LOSS,
+	MSG_CULPRIT_REVEALED,
+	// saved games
+	MSG_GAME_RESUMED,
+	MSG_GAME_SAVED,
+	MSG_SAVE_FAILED,
+	NUM_MESSAGES
+};
+
+// a single piece of narrative: the id of its text and the values
+// for the slots in the text
+struct Message {
+	MsgId id = MSG_NONE;
+	NameId name = NameInterner::NO_NAME;
+	bool male = false;
+	char letter = ' ';
+	int time = 0;
+	int count = 0;
+	int item = 0;
+	int direction = 0;
+};
+
+// writes the text of the message, with its slots filled in, to the
+// stream passed as the first parameter
+void writeMessage(std::ostream &out, const Message &msg);
+
+// returns the text of the message with its slots filled in
+std::string formatMessage(const Message &msg);
+
+// writes the message to the message sink (if there is one)
+void say(const Message &msg);
+
+// writes the message to the message sink followed by a newline (for
+// messages that are also notepad lines, which have no newline)
+void sayLine(const Message &msg);
+
+// sets the stream messages are printed to. nullptr turns printing off.
+void setMessageSink(std::ostream* sink);
+
+// returns true if messages are being printed
+bool hasMessageSink();
+
+#endif
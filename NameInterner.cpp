@@ -0,0 +1,80 @@
+/*********************************************************************
+** Program name: NameInterner.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the NameInterner class.
+**				See NameInterner.hpp.
+*********************************************************************/
+
+#include "NameInterner.hpp"
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/****************************************************************
+Returns the interner shared by all games.
+****************************************************************/
+
+NameInterner& NameInterner::shared()
+{
+	static NameInterner interner;
+	return interner;
+}
+
+/****************************************************************
+Returns the name id of the text passed as the parameter. Text
+that has not been seen before is given the next name id. The
+text is not copied.
+****************************************************************/
+
+NameId NameInterner::intern(std::string_view text)
+{
+	auto found = m_ids.find(text);
+	if (found != m_ids.end())
+	{
+		return found->second;
+	}
+
+	NameId name = m_text.size();
+	m_text.push_back(text);
+	m_ids.emplace(text, name);
+	return name;
+}
+
+/****************************************************************
+Returns the name id of the text passed as the parameter, or
+NO_NAME if the text has not been interned.
+****************************************************************/
+
+NameId NameInterner::find(std::string_view text) const
+{
+	auto found = m_ids.find(text);
+	if (found == m_ids.end())
+	{
+		return NO_NAME;
+	}
+	return found->second;
+}
+
+/****************************************************************
+Returns the text of the name id passed as the parameter. An empty
+text is returned for NO_NAME.
+****************************************************************/
+
+std::string_view NameInterner::getText(NameId name) const
+{
+	if (name >= m_text.size())
+	{
+		return std::string_view();
+	}
+	return m_text[name];
+}
+
+/****************************************************************
+Returns the number of distinct names interned.
+****************************************************************/
+
+int NameInterner::size() const
+{
+	return m_text.size();
+}
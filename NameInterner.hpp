@@ -0,0 +1,56 @@
+/*********************************************************************
+** Program name: NameInterner.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the NameInterner class.
+**				Gives every distinct guest name a 32-bit name id, so
+**				the game, the backpack and the messages can carry and
+**				compare names as ids. The text of a name is only
+**				looked up when it is printed. Names with the same
+**				text get the same id. The interner does not copy the
+**				text it is given (ex. names in the mapped roster
+**				file), so the text must outlive the interner.
+*********************************************************************/
+
+#ifndef NAMEINTERNER_HPP
+#define NAMEINTERNER_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// the id of an interned name
+typedef std::uint32_t NameId;
+
+class NameInterner {
+	public:
+		// the name id of no name (ex. a message without a name)
+		static constexpr NameId NO_NAME = 0xFFFFFFFF;
+
+		// Returns the interner shared by all games.
+		static NameInterner& shared();
+
+		// Returns the name id of the text passed as the parameter,
+		// giving the text a new id if it has not been seen.
+		NameId intern(std::string_view text);
+
+		// Returns the name id of the text passed as the parameter,
+		// or NO_NAME if the text has not been interned.
+		NameId find(std::string_view text) const;
+
+		// Returns the text of the name id passed as the parameter
+		// (empty for NO_NAME).
+		std::string_view getText(NameId name) const;
+
+		// Returns the number of distinct names interned.
+		int size() const;
+
+	private:
+		// the text of each name, indexed by name id, and the name
+		// id of each text
+		std::vector<std::string_view> m_text;
+		std::unordered_map<std::string_view, NameId> m_ids;
+};
+
+#endif
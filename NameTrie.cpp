@@ -0,0 +1,169 @@
+/*********************************************************************
+** Program name: NameTrie.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the NameTrie class.
+**				See NameTrie.hpp.
+*********************************************************************/
+
+#include "NameTrie.hpp"
+#include <string_view>
+#include <vector>
+#include <cctype>
+
+/****************************************************************
+Constructor. The trie starts with only the root node.
+****************************************************************/
+
+NameTrie::NameTrie()
+{
+	Node root;
+	for (int letter = 0; letter < NUM_LETTERS; letter++)
+	{
+		root.child[letter] = NO_NODE;
+	}
+	root.count = 0;
+	root.firstGuest = -1;
+	m_nodes.push_back(root);
+}
+
+/****************************************************************
+Returns the letter index (0 for 'a' to 25 for 'z', of either
+case) of the character passed as the parameter, or -1 if the
+character is not a letter.
+****************************************************************/
+
+int NameTrie::letterIndex(char letter)
+{
+	int lower = tolower(static_cast<unsigned char>(letter));
+	if (lower < 'a' || lower > 'z')
+	{
+		return -1;
+	}
+	return lower - 'a';
+}
+
+/****************************************************************
+Adds a guest to the trie. The first parameter is the guest's name
+and the second is the guest id. A node is made for each letter of
+the name that no earlier name shares, and the count of every node
+along the name goes up by one. No return value.
+****************************************************************/
+
+void NameTrie::add(std::string_view name, int guestId)
+{
+	int node = ROOT;
+	m_nodes[node].count++;
+	for (char letter : name)
+	{
+		int index = letterIndex(letter);
+		if (index < 0)
+		{
+			continue;
+		}
+		if (m_nodes[node].child[index] == NO_NODE)
+		{
+			Node next;
+			for (int i = 0; i < NUM_LETTERS; i++)
+			{
+				next.child[i] = NO_NODE;
+			}
+			next.count = 0;
+			next.firstGuest = -1;
+			m_nodes[node].child[index] = m_nodes.size();
+			m_nodes.push_back(next);
+		}
+		node = m_nodes[node].child[index];
+		m_nodes[node].count++;
+	}
+
+	m_guestIds.push_back(guestId);
+	m_nextGuest.push_back(m_nodes[node].firstGuest);
+	m_nodes[node].firstGuest = m_guestIds.size() - 1;
+}
+
+/****************************************************************
+Follows the letters of the text passed as the second parameter
+from the node passed as the first parameter (characters that are
+not letters are skipped). Returns the node reached, or NO_NODE if
+no guest's name carries on with those letters.
+****************************************************************/
+
+int NameTrie::follow(int node, std::string_view text) const
+{
+	for (char letter : text)
+	{
+		int index = letterIndex(letter);
+		if (index < 0)
+		{
+			continue;
+		}
+		node = m_nodes[node].child[index];
+		if (node == NO_NODE)
+		{
+			return NO_NODE;
+		}
+	}
+	return node;
+}
+
+/****************************************************************
+Returns the number of guests whose name passes through the node
+passed as the parameter (0 for NO_NODE).
+****************************************************************/
+
+int NameTrie::count(int node) const
+{
+	if (node == NO_NODE)
+	{
+		return 0;
+	}
+	return m_nodes[node].count;
+}
+
+/****************************************************************
+Lists the guests whose name passes through a node, in alphabetical
+order. The first parameter is the node and the guest ids found are
+added to the last parameter. The nodes are walked depth first with
+a stack, and the walk stops once the number of guests given as the
+second parameter have been found. No return value.
+****************************************************************/
+
+void NameTrie::collect(int node, int maxFound, std::vector<int> &found) const
+{
+	if (node == NO_NODE || maxFound <= 0)
+	{
+		return;
+	}
+
+	int numFound = 0;
+	std::vector<int> stack{ node };
+	while (!stack.empty())
+	{
+		int next = stack.back();
+		stack.pop_back();
+
+		// a name that ends here comes before the longer names
+		// that carry on from it
+		for (int guest = m_nodes[next].firstGuest; guest != -1;
+			guest = m_nextGuest[guest])
+		{
+			found.push_back(m_guestIds[guest]);
+			numFound++;
+			if (numFound == maxFound)
+			{
+				return;
+			}
+		}
+
+		// the children are pushed last letter first so that they
+		// come off the stack in alphabetical order
+		for (int letter = NUM_LETTERS - 1; letter >= 0; letter--)
+		{
+			if (m_nodes[next].child[letter] != NO_NODE)
+			{
+				stack.push_back(m_nodes[next].child[letter]);
+			}
+		}
+	}
+}
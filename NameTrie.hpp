@@ -0,0 +1,86 @@
+/*********************************************************************
+** Program name: NameTrie.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the NameTrie class.
+**				A prefix trie of guest names, used to find a guest
+**				by typing the start of their name (ex. when naming
+**				the thief to the police at a large party). Only the
+**				letters of a name are used, without regard to case,
+**				so "mary-jo" and "MaryJo" lead to the same guests.
+**				Each node has a child for each letter and holds the
+**				number of guests whose name passes through it, so
+**				following a prefix costs the length of the prefix
+**				however many guests are in the trie. A search can be
+**				carried on from the node the last prefix reached, so
+**				each letter typed only costs a single step. The
+**				guests under a node are listed in alphabetical order
+**				and the listing stops after the number of guests
+**				asked for.
+*********************************************************************/
+
+#ifndef NAMETRIE_HPP
+#define NAMETRIE_HPP
+
+#include <string_view>
+#include <vector>
+
+class NameTrie {
+	public:
+		// the node of the empty prefix, and the node returned when
+		// no name has the prefix
+		static constexpr int ROOT = 0;
+		static constexpr int NO_NODE = -1;
+
+		// Constructor. The trie starts with no guests.
+		NameTrie();
+
+		// Adds a guest. The first parameter is the guest's name
+		// and the second is the guest id. No return value.
+		void add(std::string_view name, int guestId);
+
+		// Follows the letters of the text passed as the second
+		// parameter from the node passed as the first parameter.
+		// Returns the node reached, or NO_NODE if no guest's name
+		// carries on with those letters.
+		int follow(int node, std::string_view text) const;
+
+		// Returns the number of guests whose name passes through
+		// the node passed as the parameter.
+		int count(int node) const;
+
+		// Adds the guest ids of the guests whose name passes
+		// through the node passed as the first parameter to the
+		// last parameter, in alphabetical order, stopping after
+		// the number of guests given as the second parameter. No
+		// return value.
+		void collect(int node, int maxFound, std::vector<int> &found) const;
+
+	private:
+		// the number of letters, and so of children of a node
+		static constexpr int NUM_LETTERS = 26;
+
+		// a single node of the trie
+		struct Node {
+			// the node for each next letter (NO_NODE if none)
+			int child[NUM_LETTERS];
+			// the number of guests whose name passes through
+			// the node
+			int count;
+			// the first guest (as an index of m_guestIds) whose
+			// name ends at the node, or -1 if none
+			int firstGuest;
+		};
+
+		std::vector<Node> m_nodes;
+		// the guest ids added, and for each the next guest whose
+		// name ends at the same node (-1 if none)
+		std::vector<int> m_guestIds;
+		std::vector<int> m_nextGuest;
+
+		// Returns the letter index (0 to 25) of the character
+		// passed as the parameter, or -1 if it is not a letter.
+		static int letterIndex(char letter);
+};
+
+#endif
@@ -17,23 +17,23 @@
 *********************************************************************/
 
 #include "Person.hpp"
+#include "Messages.hpp"
 #include <string>
+#include <string_view>
 #include <cctype>
-#include <iostream>
-#include <vector>
 #include <cstdlib>
 
 // intitialize the TYPE static constant
 const std::string Person::TYPE{ "Person" };
 
 /****************************************************************
-Constructor. The first parameter sets the name of the person.
-The second parameter is set to true if the person is a male 
-and false if the person is a female.
+Constructor. The first parameter is the table holding the guests
+(which holds the name and gender of the person) and the second 
+parameter is the guest id of the person.
 ****************************************************************/
 
-Person::Person(std::string name, bool male)
-	: m_name{ name }, m_met{ false }, m_male{ male }
+Person::Person(GuestTable* guests, int id)
+	: m_guests{ guests }, m_id{ id }
 {
 }
 
@@ -59,24 +59,18 @@ std::string Person::statType()
 }
 
 /****************************************************************
-Prints a single character to the console representing the
-Person space. The character value changes based on whether the
-Person has been met or not. The method takes no parameters and
-has no return value.
+Returns the single character that represents the Person space on
+the map. The character value changes based on whether the Person
+has been met or not. The method takes no parameters.
 ****************************************************************/
 
-void Person::printSpace() const
+char Person::getSymbol() const
 {
-	char letter;
-	if (m_met)
+	if (isMet())
 	{
-		letter = tolower(m_name[0]);
+		return tolower(getName()[0]);
 	}
-	else
-	{
-		letter = 'P';
-	}
-	std::cout << letter; 
+	return 'P';
 }
 
 /****************************************************************
@@ -89,89 +83,91 @@ otherwise.
 
 std::string Person::event()
 {
-	std::cout << m_name;
-	if (m_met)
+	// the number of greetings of each kind to choose from
+	static constexpr int NUM_GREETINGS{ MSG_HELLO_AGAIN_1 - MSG_HELLO_1 };
+
+	Message greeting{ MSG_HELLO_1 };
+	greeting.name = getNameId();
+	if (isMet())
 	{
-		static std::vector<std::string> returnMsgs{
-			": Nice to see you again.\n",
-			": Gosh, leave me alone.\n",
-			": Woaaah, you look familiar..\n",
-			": Long time no see!\n"
-		};
-		int returnInd = rand() % returnMsgs.size();
-		std::cout << returnMsgs[returnInd];
+		int returnInd = rand() % NUM_GREETINGS;
+		greeting.id = static_cast<MsgId>(MSG_HELLO_AGAIN_1 + returnInd);
+		say(greeting);
 		return "";
 	}
 	else
 	{	
-		static std::vector<std::string> introMsgs{
-			": Nice to meet you!\n",
-			": Hey, how's it going?\n",
-			": Fun party, huh? Pleasure to meet you.\n",
-			": What's up? Want to be friends?\n"	
-		};
-		int introInd = rand() % introMsgs.size();
-		std::cout << introMsgs[introInd];
+		int introInd = rand() % NUM_GREETINGS;
+		greeting.id = static_cast<MsgId>(MSG_HELLO_1 + introInd);
+		say(greeting);
 		return TYPE;
 	}
 }
 
 /****************************************************************
-Returns information related to the person as a string. The 
-method takes no parameters.
+Returns information related to the person as a Fact. The 
+person is met the first time this is called, and the fact records
+the meeting. Afterwards an empty Fact is returned. The method 
+takes no parameters.
 ****************************************************************/
 
-std::string Person::information() 
+Fact Person::information() 
 {
-	if (m_met)
+	Fact meeting;
+	if (!isMet())
 	{
-		// No further information is sent if the person is 
-		// already met
-		return "";
-	}
-
-	else
-	{
-		m_met = true;
-		std::string meeting = "I met " + m_name + ". " + m_name
-			+ " is ";
-		if (m_male)
-		{
-			meeting += "male.";
-		}
-		else
-		{
-			meeting += "female.";
-		}
-		return meeting;	
+		m_guests->setMet(m_id);
+		meeting.kind = FACT_MET_GUEST;
+		meeting.guest = m_id;
 	}
+	// No further information is sent if the person is 
+	// already met
+	return meeting;
 }
 
 /****************************************************************
-Getter method for the m_male variable. 
+Returns true if the person is male. 
 ****************************************************************/
 
 bool Person::isMale() const
 {
-	return m_male;
+	return m_guests->isMale(m_id);
+}
+
+/****************************************************************
+Returns the name of the person.
+****************************************************************/
+
+std::string_view Person::getName() const
+{
+	return m_guests->getName(m_id);
+}
+
+/****************************************************************
+Returns the name id of the person's name (see NameInterner).
+****************************************************************/
+
+NameId Person::getNameId() const
+{
+	return m_guests->getNameId(m_id);
 }
 
 /****************************************************************
-Getter method for the m_name variable.
+Getter method for the m_id variable.
 ****************************************************************/
 
-std::string Person::getName() const
+int Person::getId() const
 {
-	return m_name;
+	return m_id;
 }
 
 /****************************************************************
-Getter method for the m_met variable.
+Returns true if the person has been met.
 ****************************************************************/
 
 bool Person::isMet() const
 {
-	return m_met;
+	return m_guests->isMet(m_id);
 }
 
 
@@ -5,7 +5,8 @@
 ** Description:	Header file for the Person class.
 **				Derived class of the Space class. Used with the 
 **				ThiefGame class to represents party guests in the 
-**				game. Each person object holds various information
+**				game. A person only holds its guest id: the guest's
+**				information is kept in the game's GuestTable,
 **				including:
 **				- name
 **				- gender
@@ -20,26 +21,26 @@
 #define PERSON_HPP
 
 #include "Space.hpp"
+#include "Fact.hpp"
+#include "GuestTable.hpp"
 #include <string>
+#include <string_view>
 
 class Person : public Space {
 	private:
-		// holds the name of the person
-		std::string m_name;
-		// holds true if the person has been met and
-		// false otherwise
-		bool m_met;
-		// holds true if the person is male and false
-		// otherwise.
-		bool m_male;
+		// the table holding the guest's information (not owned
+		// by the person)
+		GuestTable* m_guests;
+		// holds the guest id of the person
+		int m_id;
 		// constant representing the type of Person
 		// spaces
 		static const std::string TYPE;
 	public:
-		// Constructor. The first parameter sets the
-		// name of the person and the second parameter
-		// is true if the person is male and false if female.
-		Person(std::string name, bool male);
+		// Constructor. The first parameter is the table
+		// holding the guests and the second parameter is the
+		// guest id of the person.
+		Person(GuestTable* guests, int id);
 
 		// Returns a string representing the Person
 		// type. Used to distinguish Person spaces 
@@ -52,9 +53,9 @@ class Person : public Space {
 		// object instance.
 		static std::string statType();
 
-		// Prints a single character to the console
-		// representing the Person space.
-		virtual void printSpace() const override;
+		// Returns the single character that represents
+		// the Person space on the map.
+		virtual char getSymbol() const override;
 
 		// Performs an event related to the Person
 		// and returns a string representing the
@@ -62,16 +63,22 @@ class Person : public Space {
 		virtual std::string event() override;
 
 		// Returns information related to the Person
-		// as a string. No parameters.
-		virtual std::string information() override;
+		// as a Fact. No parameters.
+		virtual Fact information() override;
 
-		// Getter method for the m_male variable. 
+		// Returns true if the person is male.
 		bool isMale() const;
 	
-		// Getter method for the m_name variable.
-		std::string getName() const;
+		// Returns the name of the person.
+		std::string_view getName() const;
 
-		// Getter method for the m_met variable.
+		// Returns the name id of the person's name.
+		NameId getNameId() const;
+
+		// Getter method for the m_id variable.
+		int getId() const;
+
+		// Returns true if the person has been met.
 		bool isMet() const;
 };
 
@@ -0,0 +1,340 @@
+/*********************************************************************
+** Program name: RoomLayout.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the RoomLayout class.
+**				See RoomLayout.hpp for the layout file format.
+*********************************************************************/
+
+#include "RoomLayout.hpp"
+#include "GuestRoster.hpp"
+#include "Snapshot.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/****************************************************************
+Constructor. The first parameter is the mapped layout file and the
+second is its size in bytes. The layout unmaps the file when it is
+destroyed. The tables are only found if the file is large enough
+to hold them, and isValid checks the rest.
+****************************************************************/
+
+RoomLayout::RoomLayout(void* map, std::size_t mapSize)
+	: m_map{ map },
+	  m_mapSize{ mapSize },
+	  m_header{ nullptr },
+	  m_tiles{ nullptr },
+	  m_guests{ nullptr },
+	  m_clues{ nullptr }
+{
+	if (m_mapSize < sizeof(Header))
+	{
+		return;
+	}
+	m_header = static_cast<const Header*>(m_map);
+	if (m_header->rows > MAX_SIDE || m_header->cols > MAX_SIDE)
+	{
+		return;
+	}
+
+	// the sizes are worked out in 64 bits, so a large count in a
+	// bad file can't wrap around
+	std::uint64_t tilesStart = sizeof(Header);
+	std::uint64_t guestsStart = tilesStart
+		+ tilesSize(std::uint64_t(m_header->rows) * m_header->cols);
+	std::uint64_t cluesStart = guestsStart
+		+ std::uint64_t(m_header->numGuests) * sizeof(Guest);
+	std::uint64_t end = cluesStart
+		+ std::uint64_t(m_header->numClues) * sizeof(Clue);
+	if (end != m_mapSize)
+	{
+		return;
+	}
+
+	const unsigned char* bytes = static_cast<const unsigned char*>(m_map);
+	m_tiles = bytes + tilesStart;
+	m_guests = reinterpret_cast<const Guest*>(bytes + guestsStart);
+	m_clues = reinterpret_cast<const Clue*>(bytes + cluesStart);
+}
+
+/****************************************************************
+Destructor. Unmaps the layout file.
+****************************************************************/
+
+RoomLayout::~RoomLayout()
+{
+	munmap(m_map, m_mapSize);
+}
+
+/****************************************************************
+Returns the layout in the file whose path is the parameter. The
+file is mapped read-only and checked in full the first time it is
+opened. Later calls with the same path return the same layout, so
+every game using a layout shares a single mapping. Returns nullptr
+if the file can't be read or is not a valid layout.
+****************************************************************/
+
+const RoomLayout* RoomLayout::open(const char* path)
+{
+	static std::unordered_map<std::string,
+		std::unique_ptr<RoomLayout>> opened;
+
+	auto found = opened.find(path);
+	if (found != opened.end())
+	{
+		return found->second.get();
+	}
+
+	int fd = ::open(path, O_RDONLY);
+	if (fd == -1)
+	{
+		return nullptr;
+	}
+	void* map = MAP_FAILED;
+	struct stat info;
+	if (fstat(fd, &info) == 0 && info.st_size > 0)
+	{
+		map = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	}
+	// the mapping stays valid once the file is closed
+	close(fd);
+	if (map == MAP_FAILED)
+	{
+		return nullptr;
+	}
+
+	std::unique_ptr<RoomLayout> layout(new RoomLayout(map, info.st_size));
+	if (!layout->isValid())
+	{
+		return nullptr;
+	}
+	RoomLayout* shared = layout.get();
+	opened.emplace(path, std::move(layout));
+	return shared;
+}
+
+/****************************************************************
+Returns true if the mapped file holds a valid layout: the header
+is right, the tables fill the file exactly, and every tile, guest
+and clue makes sense for the room and the guest roster. The guests
+must be different roster guests, each on a person tile of its own,
+and every person tile must hold a guest. Each clue must be on a
+clue tile of its own and every clue tile must hold a clue. The
+player must start on a floor tile.
+****************************************************************/
+
+bool RoomLayout::isValid() const
+{
+	if (m_clues == nullptr
+		|| memcmp(m_header->magic, MAGIC, MAGIC_LENGTH) != 0
+		|| m_header->version != VERSION)
+	{
+		return false;
+	}
+
+	std::uint32_t numCells = m_header->rows * m_header->cols;
+	if (numCells == 0 || m_header->numGuests == 0
+		|| m_header->numCulprits == 0
+		|| m_header->numCulprits > m_header->numGuests
+		|| m_header->playerCell >= numCells
+		|| m_tiles[m_header->playerCell] != FLOOR)
+	{
+		return false;
+	}
+
+	// the tiles are counted off as the guests and clues claim them
+	std::vector<unsigned char> claimed(numCells, 0);
+	int numPeople = 0;
+	int numClueTiles = 0;
+	for (std::uint32_t cell = 0; cell < numCells; cell++)
+	{
+		if (m_tiles[cell] >= NUM_TILES)
+		{
+			return false;
+		}
+		numPeople += m_tiles[cell] == PERSON;
+		numClueTiles += m_tiles[cell] == CLUE;
+	}
+	if (std::uint32_t(numPeople) != m_header->numGuests
+		|| std::uint32_t(numClueTiles) != m_header->numClues)
+	{
+		return false;
+	}
+
+	GuestRoster& roster = GuestRoster::shared();
+	std::vector<bool> invited(roster.size(), false);
+	for (std::uint32_t i = 0; i < m_header->numGuests; i++)
+	{
+		const Guest &guest = m_guests[i];
+		if (guest.rosterEntry >= invited.size()
+			|| invited[guest.rosterEntry] || guest.cell >= numCells
+			|| m_tiles[guest.cell] != PERSON || claimed[guest.cell])
+		{
+			return false;
+		}
+		invited[guest.rosterEntry] = true;
+		claimed[guest.cell] = 1;
+	}
+
+	for (std::uint32_t i = 0; i < m_header->numClues; i++)
+	{
+		const Clue &clue = m_clues[i];
+		if (clue.cell >= numCells || m_tiles[clue.cell] != CLUE
+			|| claimed[clue.cell] || clue.letterClue > 1
+			|| clue.group > 1 || clue.male > 1)
+		{
+			return false;
+		}
+		if (clue.letterClue && (clue.letter < 'a' || clue.letter > 'z'))
+		{
+			return false;
+		}
+		claimed[clue.cell] = 1;
+	}
+	return true;
+}
+
+/****************************************************************
+Returns the size in bytes of the tile table of a room with the
+number of cells passed as the parameter: a byte for each cell,
+padded so that the guest table starts on a 4-byte boundary.
+****************************************************************/
+
+std::size_t RoomLayout::tilesSize(std::size_t numCells)
+{
+	return (numCells + 3) & ~std::size_t(3);
+}
+
+/****************************************************************
+Writes a layout file. The parameters are the path of the file, the
+rows and columns of the room, the tile of each cell, the guests
+(with the culprits first), the number of culprits, the clues and
+the player's starting cell. The file is written in one step (see
+writeSnapshotFile) and is not checked; it is checked when it is
+opened. Returns true if the file was written.
+****************************************************************/
+
+bool RoomLayout::write(const char* path, int rows, int cols,
+	const std::vector<unsigned char> &tiles,
+	const std::vector<Guest> &guests, int numCulprits,
+	const std::vector<Clue> &clues, int playerCell)
+{
+	Header header;
+	memcpy(header.magic, MAGIC, MAGIC_LENGTH);
+	header.version = VERSION;
+	header.rows = rows;
+	header.cols = cols;
+	header.numGuests = guests.size();
+	header.numCulprits = numCulprits;
+	header.numClues = clues.size();
+	header.playerCell = playerCell;
+
+	std::vector<unsigned char> file(sizeof(Header)
+		+ tilesSize(tiles.size()), 0);
+	memcpy(file.data(), &header, sizeof(Header));
+	memcpy(file.data() + sizeof(Header), tiles.data(), tiles.size());
+	const unsigned char* guestBytes =
+		reinterpret_cast<const unsigned char*>(guests.data());
+	file.insert(file.end(), guestBytes,
+		guestBytes + guests.size() * sizeof(Guest));
+	const unsigned char* clueBytes =
+		reinterpret_cast<const unsigned char*>(clues.data());
+	file.insert(file.end(), clueBytes,
+		clueBytes + clues.size() * sizeof(Clue));
+
+	return writeSnapshotFile(path, file);
+}
+
+/****************************************************************
+Returns the number of rows of the room.
+****************************************************************/
+
+int RoomLayout::getRows() const
+{
+	return m_header->rows;
+}
+
+/****************************************************************
+Returns the number of columns of the room.
+****************************************************************/
+
+int RoomLayout::getCols() const
+{
+	return m_header->cols;
+}
+
+/****************************************************************
+Returns the tile of the cell (row * columns + col) passed as the
+parameter.
+****************************************************************/
+
+RoomLayout::Tile RoomLayout::getTile(int cell) const
+{
+	return static_cast<Tile>(m_tiles[cell]);
+}
+
+/****************************************************************
+Returns the number of guests in the room.
+****************************************************************/
+
+int RoomLayout::numGuests() const
+{
+	return m_header->numGuests;
+}
+
+/****************************************************************
+Returns the number of culprits, which are the first guests of the
+guest table.
+****************************************************************/
+
+int RoomLayout::numCulprits() const
+{
+	return m_header->numCulprits;
+}
+
+/****************************************************************
+Returns the number of clues in the room.
+****************************************************************/
+
+int RoomLayout::numClues() const
+{
+	return m_header->numClues;
+}
+
+/****************************************************************
+Returns the guest at the index of the guest table passed as the
+parameter.
+****************************************************************/
+
+const RoomLayout::Guest& RoomLayout::getGuest(int index) const
+{
+	return m_guests[index];
+}
+
+/****************************************************************
+Returns the clue at the index of the clue table passed as the
+parameter.
+****************************************************************/
+
+const RoomLayout::Clue& RoomLayout::getClue(int index) const
+{
+	return m_clues[index];
+}
+
+/****************************************************************
+Returns the cell the player starts on.
+****************************************************************/
+
+int RoomLayout::getPlayerCell() const
+{
+	return m_header->playerCell;
+}
@@ -0,0 +1,148 @@
+/*********************************************************************
+** Program name: RoomLayout.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the RoomLayout class.
+**				A prebuilt party room, read from a layout file rather
+**				than set up at random. The file is mapped into memory
+**				read-only and its tables are used where they lie, so
+**				nothing is parsed or copied, and a layout opened once
+**				is shared by every game that uses it.
+**				Layout file format (version 1). Every number is a
+**				32-bit unsigned integer in the byte order of the
+**				machine, and every table starts on a 4-byte boundary
+**				of the file:
+**				- the header: the bytes "FTTL", the version, rows,
+**				  columns, number of guests, number of culprits,
+**				  number of clues and the player's cell
+**				- the tiles: a byte for each cell (as row * columns
+**				  + col) holding a Tile, padded with zero bytes to a
+**				  multiple of 4
+**				- the guests: for each guest its index in the guest
+**				  roster and its cell. The culprits are the first
+**				  guests of the table.
+**				- the clues: for each clue its cell, then a byte each
+**				  for whether it is a letter clue (rather than a
+**				  gender clue), whether it describes a group of
+**				  culprits, the gender and the letter
+**				A layout is checked in full when it is opened (every
+**				guest and clue sits on a tile of its kind, every
+**				person tile has a guest, the player starts on the
+**				floor...), so games can build the room from it
+**				without checking it again.
+*********************************************************************/
+
+#ifndef ROOMLAYOUT_HPP
+#define ROOMLAYOUT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class RoomLayout {
+	public:
+		// the kind of Space in each cell
+		enum Tile : unsigned char { FLOOR = 0, PERSON, CLUE, STEREO,
+			LAUNCHER, FIREWORKS, TRUTH_CANDY, NUM_TILES };
+
+		// a guest of the guest table
+		struct Guest {
+			std::uint32_t rosterEntry;
+			std::uint32_t cell;
+		};
+
+		// a clue of the clue table
+		struct Clue {
+			std::uint32_t cell;
+			unsigned char letterClue;
+			unsigned char group;
+			unsigned char male;
+			char letter;
+		};
+
+		// Returns the layout in the file whose path is the parameter,
+		// or nullptr if the file can't be read or is not a valid
+		// layout for the guest roster. A file is only opened once:
+		// later calls with the same path return the same layout,
+		// which lasts until the program ends.
+		static const RoomLayout* open(const char* path);
+
+		// Writes a layout file. The parameters are the path, the
+		// rows and columns, the tile of each cell, the guests (the
+		// culprits first), the number of culprits, the clues and
+		// the player's cell. Returns true if the file was written.
+		static bool write(const char* path, int rows, int cols,
+			const std::vector<unsigned char> &tiles,
+			const std::vector<Guest> &guests, int numCulprits,
+			const std::vector<Clue> &clues, int playerCell);
+
+		// the layout owns its mapping so it cannot be copied
+		RoomLayout(const RoomLayout&) = delete;
+		RoomLayout& operator=(const RoomLayout&) = delete;
+
+		// Destructor. Unmaps the layout file.
+		~RoomLayout();
+
+		// Returns the number of rows / columns of the room.
+		int getRows() const;
+		int getCols() const;
+
+		// Returns the tile of the cell passed as the parameter.
+		Tile getTile(int cell) const;
+
+		// Returns the number of guests / culprits / clues.
+		int numGuests() const;
+		int numCulprits() const;
+		int numClues() const;
+
+		// Returns the guest / clue at the index passed as the
+		// parameter.
+		const Guest& getGuest(int index) const;
+		const Clue& getClue(int index) const;
+
+		// Returns the cell the player starts on.
+		int getPlayerCell() const;
+
+	private:
+		// the bytes a layout file starts with and the version of
+		// the format
+		static constexpr char MAGIC[] = "FTTL";
+		static constexpr int MAGIC_LENGTH = 4;
+		static constexpr std::uint32_t VERSION = 1;
+		// the most rows or columns a layout can have
+		static constexpr std::uint32_t MAX_SIDE = 1 << 15;
+
+		// the header of a layout file
+		struct Header {
+			char magic[MAGIC_LENGTH];
+			std::uint32_t version;
+			std::uint32_t rows;
+			std::uint32_t cols;
+			std::uint32_t numGuests;
+			std::uint32_t numCulprits;
+			std::uint32_t numClues;
+			std::uint32_t playerCell;
+		};
+
+		// the mapped file and its size in bytes, and the tables
+		// inside it
+		void* m_map;
+		std::size_t m_mapSize;
+		const Header* m_header;
+		const unsigned char* m_tiles;
+		const Guest* m_guests;
+		const Clue* m_clues;
+
+		// Constructor. The parameters are the mapped file and its
+		// size, which the layout takes over.
+		RoomLayout(void* map, std::size_t mapSize);
+
+		// Returns the size in bytes of the tile table of a room
+		// with the given number of cells (padded to 4 bytes).
+		static std::size_t tilesSize(std::size_t numCells);
+
+		// Returns true if the mapped file holds a valid layout.
+		bool isValid() const;
+};
+
+#endif
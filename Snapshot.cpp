@@ -0,0 +1,304 @@
+/*********************************************************************
+** Program name: Snapshot.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the SnapshotWriter and
+**				SnapshotReader classes and the snapshot file
+**				functions. See Snapshot.hpp for the format of a game
+**				snapshot.
+*********************************************************************/
+
+#include "Snapshot.hpp"
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/****************************************************************
+Constructor. The snapshot is added to the end of the vector
+passed as the parameter.
+****************************************************************/
+
+SnapshotWriter::SnapshotWriter(std::vector<unsigned char> &out)
+	: m_out(out)
+{
+}
+
+/****************************************************************
+Adds a number as a varint. Seven bits are stored per byte,
+starting with the lowest bits, and the high bit is set on every
+byte except the last. No return value.
+****************************************************************/
+
+void SnapshotWriter::putVarint(unsigned int value)
+{
+	while (value >= 0x80)
+	{
+		m_out.push_back(static_cast<unsigned char>(value | 0x80));
+		value >>= 7;
+	}
+	m_out.push_back(static_cast<unsigned char>(value));
+}
+
+/****************************************************************
+Adds a number that may be negative. The number is zigzag encoded
+so that small negative numbers stay small. No return value.
+****************************************************************/
+
+void SnapshotWriter::putInt(int value)
+{
+	unsigned int bits = static_cast<unsigned int>(value);
+	putVarint(value < 0 ? ~(bits << 1) : bits << 1);
+}
+
+/****************************************************************
+Adds the bytes passed as the first parameter. The second
+parameter is the number of bytes. No return value.
+****************************************************************/
+
+void SnapshotWriter::putBytes(const char* bytes, int length)
+{
+	m_out.insert(m_out.end(), bytes, bytes + length);
+}
+
+/****************************************************************
+Constructor. The first parameter is the snapshot and the second
+parameter is its length in bytes.
+****************************************************************/
+
+SnapshotReader::SnapshotReader(const unsigned char* data,
+	std::size_t size)
+	: m_pos{ data },
+	  m_end{ data + size },
+	  m_ok{ true }
+{
+}
+
+/****************************************************************
+Returns the next varint of the snapshot. The reader fails if the
+snapshot ends in the middle of the varint or the varint is too
+long for an unsigned int, and 0 is returned once it has failed.
+****************************************************************/
+
+unsigned int SnapshotReader::getVarint()
+{
+	static constexpr int MAX_SHIFT{ 28 };
+
+	unsigned int value = 0;
+	int shift = 0;
+	while (m_ok)
+	{
+		if (m_pos == m_end || shift > MAX_SHIFT)
+		{
+			fail();
+			break;
+		}
+		unsigned char byte = *m_pos++;
+		value |= static_cast<unsigned int>(byte & 0x7F) << shift;
+		if (!(byte & 0x80))
+		{
+			return value;
+		}
+		shift += 7;
+	}
+	return 0;
+}
+
+/****************************************************************
+Returns the next number written with putInt (zigzag decoded).
+****************************************************************/
+
+int SnapshotReader::getInt()
+{
+	unsigned int bits = getVarint();
+	return static_cast<int>((bits >> 1) ^ (0u - (bits & 1)));
+}
+
+/****************************************************************
+Returns the next varint of the snapshot. The reader fails (and 0
+is returned) if the varint is greater than the parameter.
+****************************************************************/
+
+unsigned int SnapshotReader::getAtMost(unsigned int max)
+{
+	unsigned int value = getVarint();
+	if (value > max)
+	{
+		fail();
+		return 0;
+	}
+	return value;
+}
+
+/****************************************************************
+Returns true if the bytes passed as the first parameter come next
+in the snapshot (the second parameter is the number of bytes).
+The reader fails otherwise.
+****************************************************************/
+
+bool SnapshotReader::expectBytes(const char* bytes, int length)
+{
+	if (!m_ok || m_end - m_pos < length
+		|| memcmp(m_pos, bytes, length) != 0)
+	{
+		fail();
+		return false;
+	}
+	m_pos += length;
+	return true;
+}
+
+/****************************************************************
+Returns a pointer to the next bytes of the snapshot (the number of
+bytes is the parameter) and moves past them. The bytes are not 
+copied. The reader fails and nullptr is returned if the snapshot
+ends first.
+****************************************************************/
+
+const unsigned char* SnapshotReader::getBytes(std::size_t length)
+{
+	if (!m_ok || static_cast<std::size_t>(m_end - m_pos) < length)
+	{
+		fail();
+		return nullptr;
+	}
+	const unsigned char* bytes = m_pos;
+	m_pos += length;
+	return bytes;
+}
+
+/****************************************************************
+Returns the number of bytes of the snapshot not yet read (0 once
+the reader has failed).
+****************************************************************/
+
+std::size_t SnapshotReader::remaining() const
+{
+	return m_end - m_pos;
+}
+
+/****************************************************************
+Marks the reader as failed. Every read after this returns 0. No
+return value.
+****************************************************************/
+
+void SnapshotReader::fail()
+{
+	m_ok = false;
+	m_pos = m_end;
+}
+
+/****************************************************************
+Returns true if every read so far was valid.
+****************************************************************/
+
+bool SnapshotReader::ok() const
+{
+	return m_ok;
+}
+
+/****************************************************************
+Returns true if the whole snapshot has been read (and every read
+was valid).
+****************************************************************/
+
+bool SnapshotReader::atEnd() const
+{
+	return m_ok && m_pos == m_end;
+}
+
+/****************************************************************
+Writes a snapshot to a file. The first parameter is the path of
+the file and the second is the snapshot. The snapshot is written
+to a temporary file next to it, which is flushed to disk and then
+renamed over the file, so the file always holds either the old or
+the new snapshot in full. Returns true if the snapshot was
+written.
+****************************************************************/
+
+bool writeSnapshotFile(const char* path,
+	const std::vector<unsigned char> &snapshot)
+{
+	std::string tempPath = std::string(path) + ".tmp";
+	int fd = open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd == -1)
+	{
+		return false;
+	}
+
+	std::size_t written = 0;
+	while (written < snapshot.size())
+	{
+		ssize_t result = write(fd, snapshot.data() + written,
+			snapshot.size() - written);
+		if (result < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (result <= 0)
+		{
+			close(fd);
+			unlink(tempPath.c_str());
+			return false;
+		}
+		written += result;
+	}
+
+	bool saved = fsync(fd) == 0;
+	saved = close(fd) == 0 && saved;
+	if (!saved || rename(tempPath.c_str(), path) != 0)
+	{
+		unlink(tempPath.c_str());
+		return false;
+	}
+	return true;
+}
+
+/****************************************************************
+Reads a snapshot file. The first parameter is the path of the
+file and the snapshot is placed in the second parameter. Returns
+true if the file was read.
+****************************************************************/
+
+bool readSnapshotFile(const char* path, std::vector<unsigned char> &snapshot)
+{
+	snapshot.clear();
+	int fd = open(path, O_RDONLY);
+	if (fd == -1)
+	{
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) == 0 && info.st_size > 0)
+	{
+		snapshot.reserve(info.st_size);
+	}
+
+	unsigned char buffer[4096];
+	while (true)
+	{
+		ssize_t result = read(fd, buffer, sizeof(buffer));
+		if (result < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (result < 0)
+		{
+			close(fd);
+			return false;
+		}
+		if (result == 0)
+		{
+			break;
+		}
+		snapshot.insert(snapshot.end(), buffer, buffer + result);
+	}
+	close(fd);
+	return true;
+}
@@ -0,0 +1,126 @@
+/*********************************************************************
+** Program name: Snapshot.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the SnapshotWriter and SnapshotReader
+**				classes, used to save the complete state of a game
+**				(see ThiefGame::save) as a compact binary snapshot
+**				and to read it back. Like the event stream, every
+**				number is an unsigned varint (7 bits per byte, low
+**				bits first, high bit set on every byte but the last).
+**				Numbers that can be negative are zigzag encoded first
+**				(0, -1, 1, -2, ... become 0, 1, 2, 3, ...), so small
+**				numbers of either sign take a single byte.
+**				The reader never reads past the end of the snapshot:
+**				once it runs out of bytes (or a check fails) it is
+**				marked as failed and only returns 0 from then on, so
+**				a snapshot can be read in full and checked once at
+**				the end.
+**				Snapshot files are written to a temporary file that
+**				is then renamed over the old file, so a crash while
+**				saving never leaves a half written snapshot.
+**				Game snapshot format (version 1): the bytes "FTTS",
+**				the version, then
+**				- the game options: minute length in milliseconds,
+**				  backpack slots, 1 if guests wander, culprits
+**				- the state of the game's random number generator
+**				  and of the crowd's generator
+**				- the current minute, the end minute, 1 if the game
+**				  is finished and 1 if the guess made is correct
+**				- the guests: a count, then for each guest its index
+**				  in the guest roster and its flags
+**				- the culprits: a count, then their guest ids
+**				- the room: rows, columns, then for each cell a tile
+**				  (see RoomLayout::Tile) followed by its fields (a 
+**				  Person's guest id;
+**				  a Clue's message id, gender and letter; a Stereo's
+**				  power)
+**				- the player's cell
+**				- the timers: a count, then for each timer its
+**				  minute, event, value and role (0 for none, 1 for
+**				  the party end and 2 for the police arrival), in
+**				  the order they fire
+**				- the backpack: the item bits, 1 if the police were
+**				  called, the contacts (a count then guest ids) and
+**				  the notes (a count then each note's kind, guest,
+**				  value and minute)
+*********************************************************************/
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstddef>
+#include <vector>
+
+class SnapshotWriter {
+	public:
+		// Constructor. The snapshot is added to the end of the
+		// vector passed as the parameter, which is not owned by
+		// the writer.
+		SnapshotWriter(std::vector<unsigned char> &out);
+
+		// Adds a number as a varint. No return value.
+		void putVarint(unsigned int value);
+
+		// Adds a number that may be negative. No return value.
+		void putInt(int value);
+
+		// Adds the given number of bytes. No return value.
+		void putBytes(const char* bytes, int length);
+
+	private:
+		std::vector<unsigned char> &m_out;
+};
+
+class SnapshotReader {
+	public:
+		// Constructor. The parameters are the snapshot and its
+		// length in bytes. The snapshot is not copied.
+		SnapshotReader(const unsigned char* data, std::size_t size);
+
+		// Returns the next varint (0 once the reader has failed).
+		unsigned int getVarint();
+
+		// Returns the next number written with putInt.
+		int getInt();
+
+		// Returns the next varint, failing the reader if it is
+		// greater than the parameter.
+		unsigned int getAtMost(unsigned int max);
+
+		// Returns true if the given bytes come next, and fails
+		// the reader otherwise.
+		bool expectBytes(const char* bytes, int length);
+
+		// Returns the next given number of bytes (which are not
+		// copied), or nullptr if the snapshot ends first.
+		const unsigned char* getBytes(std::size_t length);
+
+		// Returns the number of bytes not yet read.
+		std::size_t remaining() const;
+
+		// Marks the reader as failed. No return value.
+		void fail();
+
+		// Returns true if every read so far was valid.
+		bool ok() const;
+
+		// Returns true if the whole snapshot has been read.
+		bool atEnd() const;
+
+	private:
+		const unsigned char* m_pos;
+		const unsigned char* m_end;
+		bool m_ok;
+};
+
+// Writes a snapshot to the file whose path is the first parameter,
+// replacing the file in one step. Returns true if it was written.
+bool writeSnapshotFile(const char* path,
+	const std::vector<unsigned char> &snapshot);
+
+// Reads the file whose path is the first parameter into the second
+// parameter. Returns true if the file was read.
+bool readSnapshotFile(const char* path, std::vector<unsigned char> &snapshot);
+
+#endif
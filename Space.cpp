@@ -13,22 +13,27 @@
 **				A Space has getter and setter methods for each of
 **				its adjacent pointers. Every Space has a type, a
 **				console print method, an event, and information that
-**				it provides.
+**				it provides. Each Space also records the row and
+**				column it occupies in the room.
 *********************************************************************/
 
 #include "Space.hpp"
 #include <string>
+#include <iostream>
 
 /****************************************************************
 Default constructor. Sets the adjacent Space pointers to 
-nullptr. 
+nullptr. The position is set to -1 until the Space is placed
+in a room.
 ****************************************************************/
 
 Space::Space()
 	: upSpace{ nullptr },
 	  rightSpace{ nullptr },
 	  downSpace{ nullptr },
-	  leftSpace{ nullptr }
+	  leftSpace{ nullptr },
+	  row{ -1 },
+	  col{ -1 }
 {
 }
 
@@ -104,6 +109,45 @@ Space* Space::getLeft() const
 	return leftSpace;
 }
 
+/****************************************************************
+Sets the row and column of the Space within the room. No return
+value.
+****************************************************************/
+
+void Space::setPosition(int r, int c)
+{
+	row = r;
+	col = c;
+}
+
+/****************************************************************
+Getter method. Returns the row of the Space in the room.
+****************************************************************/
+
+int Space::getRow() const
+{
+	return row;
+}
+
+/****************************************************************
+Getter method. Returns the column of the Space in the room.
+****************************************************************/
+
+int Space::getCol() const
+{
+	return col;
+}
+
+/****************************************************************
+Prints the single character representing the Space on the map
+to the console. No parameters and no return value.
+****************************************************************/
+
+void Space::printSpace() const
+{
+	std::cout << getSymbol();
+}
+
 /****************************************************************
 Virtual destructor. The class does not make use of any 
 dynamically allocated memory. But a virtual destructor is 
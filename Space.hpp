@@ -13,13 +13,15 @@
 **				A Space has getter and setter methods for each of
 **				its adjacent pointers. Every Space has a type, a
 **				console print method, an event, and information that
-**				it provides.
+**				it provides. Each Space also records the row and
+**				column it occupies in the room.
 *********************************************************************/
 
 #ifndef SPACE_HPP
 #define SPACE_HPP
 
 #include <string>
+#include "Fact.hpp"
 
 class Space {
 	private:
@@ -28,6 +30,9 @@ class Space {
 		Space* rightSpace;
 		Space* downSpace;
 		Space* leftSpace;
+		// row and column of the Space within the room
+		int row;
+		int col;
 	public:
 		// default constructor
 		Space();
@@ -42,13 +47,23 @@ class Space {
 		Space* getDown() const;
 		Space* getLeft() const;
 
+		// setter and getter methods for the location of the
+		// Space in the room
+		void setPosition(int r, int c);
+		int getRow() const;
+		int getCol() const;
+
 		// pure virtual method that is meant to return the derived
 		// type of the Space as a string
 		virtual std::string getType() const = 0;
 
-		// pure virtual method that is meant to print a single
-		// character to the console representing the derived Space
-		virtual void printSpace() const = 0;
+		// pure virtual method that is meant to return the single
+		// character representing the derived Space on the map
+		virtual char getSymbol() const = 0;
+
+		// prints the character returned by getSymbol to the
+		// console
+		void printSpace() const;
 
 		// pure virtual method that is meant to perform an event
 		// related to the derived Space and returns a string
@@ -57,8 +72,8 @@ class Space {
 
 		// pure virtual method that is meant to return 
 		// information relating to the derived Space as 
-		// a string.
-		virtual std::string information() = 0;
+		// a Fact for the notepad (see Fact.hpp).
+		virtual Fact information() = 0;
 
 		// Virtual destructor. The class does not make use of
 		// any dynamically allocated memory. But a virtual 
@@ -16,7 +16,7 @@
 
 #include "Stereo.hpp"
 #include "Menu.hpp"
-#include <iostream>
+#include "Messages.hpp"
 #include <string>
 
 // intitialize the TYPE static constant
@@ -32,6 +32,16 @@ Stereo::Stereo()
 {
 }
 
+/****************************************************************
+Constructor. The single parameter holds true if the stereo has
+power. Used to restore a stereo from a saved game.
+****************************************************************/
+
+Stereo::Stereo(bool power)
+	: m_power{ power }
+{
+}
+
 /****************************************************************
 Returns the TYPE string which represents the Stereo type.
 No parameters.
@@ -54,14 +64,13 @@ std::string Stereo::statType()
 }
 
 /****************************************************************
-Prints a single character to the console representing the
-Stereo space. The method takes no parameters and has no return 
-value.
+Returns the single character that represents the Stereo
+space on the map. The method takes no parameters.
 ****************************************************************/
 
-void Stereo::printSpace() const
+char Stereo::getSymbol() const
 {
-	std::cout << "S"; 
+	return 'S';
 }
 
 /****************************************************************
@@ -89,8 +98,7 @@ int Stereo::playStereo()
 	// check to see if the stereo does not have power
 	if (!m_power)
 	{
-		std::cout << "The power cord to the stereo is torn to "
-			<< "shreds and is no longer functional.\n";	
+		say(Message{ MSG_STEREO_BROKEN });
 		return 0;
 	}
 
@@ -102,8 +110,7 @@ int Stereo::playStereo()
 	playMenu.addOption("Your favorite Lizzo song");
 	playMenu.addOption("Baha Men - Who Let the Dogs Out");
 
-	std::cout << "\nThere are two song options on the stereo; "
-		<< "make your pick!\n";	
+	say(Message{ MSG_STEREO_CHOICE });
 
 	const int LIZZO = 1;
 	const int DOGS = 2;
@@ -112,42 +119,26 @@ int Stereo::playStereo()
 
 	if (songChoice == LIZZO)
 	{
-		std::cout << "You play your favorite Lizzo song. You raise "
-			<< "the volume to a deafening blare!\nA number of guests "
-			<< "are alarmed and rapidly flee from the party.\n"
-			<< "A particularly affected guest lets out a howl of "
-			<< "existential terror.\nThe thief has a poor taste in "
-			<< "music and stays despite the cacophony.\nOne of the " 
-			<< "traumatized guests tears apart the power cord to the "
-			<< "stereo in a fit\nof hysteria before exiting the event.\n";
+		say(Message{ MSG_STEREO_BAD_MUSIC });
 		return LIZZO;
 	}
 
 	else
 	{
-		std::cout << "You play Who Let the Dogs Out by Baha Men.\n"
-			<< "The guests are at once stunned and overjoyed to hear a "
-			<< "musical composition of\nsuch artistic genius. "
-			<< "The party quickly erupts into a chaotic frenzy of primal"
-			<< "\necstasy. "
-			<< "As the song ends, a guest rabidly tears apart the power"
-			<< " cord to the\nstereo exclaiming that it would be "
-			<< "disrespectful to play any other music\nfollowing such a "
-			<< "phenomenal display of unmatched artistry.\nThe party "
-			<< "applauds in unanimous agreement.\n";
+		say(Message{ MSG_STEREO_GOOD_MUSIC });
 		return DOGS;
 	}
 }
 
 /****************************************************************
-Returns information related to the Stereo as a string. Given that
+Returns information related to the Stereo as a Fact. Given that
 Stereo spaces do not contain any information, the method returns
-an empty string.
+an empty Fact.
 ****************************************************************/
 
-std::string Stereo::information() 
+Fact Stereo::information() 
 {
-	return "";	
+	return Fact();	
 }
 
 /****************************************************************
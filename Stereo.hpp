@@ -18,6 +18,7 @@
 #define STEREO_HPP
 
 #include "Space.hpp"
+#include "Fact.hpp"
 #include <string>
 
 class Stereo : public Space {
@@ -29,6 +30,10 @@ class Stereo : public Space {
 		// Default constructor 
 		Stereo();
 
+		// Constructor. The single parameter holds true if the
+		// stereo has power (ex. a stereo from a saved game).
+		Stereo(bool power);
+
 		// Returns a string representing the Stereo
 		// type. Used to distinguish Stereo spaces 
 		// from other spaces when a Space pointer is
@@ -40,9 +45,9 @@ class Stereo : public Space {
 		// object instance.
 		static std::string statType();
 
-		// Prints a single character to the console
-		// representing the Stereo space.
-		virtual void printSpace() const override;
+		// Returns the single character that represents
+		// the Stereo space on the map.
+		virtual char getSymbol() const override;
 
 		// Performs an event related to the Stereo
 		// and returns a string representing the
@@ -56,8 +61,8 @@ class Stereo : public Space {
 		int playStereo();
 
 		// Returns information related to the Stereo
-		// as a string. No parameters.
-		virtual std::string information() override;
+		// as a Fact. No parameters.
+		virtual Fact information() override;
 
 		// Getter method for the m_power variable
 		bool powerOn() const;	
@@ -26,10 +26,15 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
+#include <algorithm>
+#include <numeric>
+#include <limits>
 #include <ctime>
 #include <cstdlib>
+#include <cstdint>
 #include "ThiefGame.hpp"
 #include "Backpack.hpp"
 #include "Space.hpp"
@@ -40,6 +45,12 @@
 #include "FireworksBox.hpp"
 #include "TruthCandyBox.hpp"
 #include "Launcher.hpp"
+#include "GuestRoster.hpp"
+#include "GuestIndex.hpp"
+#include "CulpritSolver.hpp"
+#include "Snapshot.hpp"
+#include "RoomLayout.hpp"
+#include "GameJournal.hpp"
 #include "intValid.hpp"
 
 // initially indicate that the random seed for the program is 
@@ -54,31 +65,83 @@ Both the identity of the thief and the starting location of
 the player are also set. 
 *****************************************************************/
 
-ThiefGame::ThiefGame() 
-	: m_backpack{ },
+ThiefGame::ThiefGame()
+	: ThiefGame(GameOptions())
+{
+}
+
+/*****************************************************************
+Constructor. Sets up the inital state for a game with the settings
+passed as the parameter. The room is set up in the same way as 
+for the default constructor.
+*****************************************************************/
+
+ThiefGame::ThiefGame(const GameOptions &options) 
+	: ThiefGame(options, NEW_PARTY)
+{
+}
+
+/*****************************************************************
+Constructor. The first parameter holds the settings for the game.
+If the second parameter is NEW_PARTY the room is set up for a new
+game. If it is EMPTY_ROOM the room is left as empty floor, to be
+filled in from a saved game (see load).
+*****************************************************************/
+
+ThiefGame::ThiefGame(const GameOptions &options, RoomSetup setup) 
+	: m_guestIndex{ NUM_ROWS, NUM_COLS },
+	  m_crowd{ NUM_ROWS, NUM_COLS },
+	  m_playerField{ NUM_ROWS, NUM_COLS, FIELD_HORIZON },
 	  m_gameFinished{ false },
-	  m_hour{ "11" },
-	  m_min{ "00" },
-	  m_isAM{ false },
-	  m_endHour{ "11" },
-	  m_endMin{ "30" },
-	  m_endAM{ false }
+	  m_playerSpace{ nullptr },
+	  m_backpack{ options.backpackSlots },
+	  m_minute{ START_MINUTE },
+	  m_endMinute{ START_MINUTE + PARTY_LENGTH },
+	  m_options(options),
+	  m_events{ nullptr },
+	  m_partyEndTimer{ TimerWheel::NO_TIMER },
+	  m_policeTimer{ TimerWheel::NO_TIMER },
+	  m_correctGuess{ false },
+	  m_randState{ 1 },
+	  m_saveFile{ nullptr },
+	  m_resumed{ false },
+	  m_journal{ nullptr },
+	  m_checkpointMinute{ START_MINUTE }
 {
 	// set the random seed if it has not already been set in
-	// the program
+	// the program. Each game then seeds its own generators from
+	// it.
 	if (!seedSet)
 	{
 		srand(time(NULL));
 		seedSet = true;
 	}
+	m_randState = rand() | 1;
+	m_crowd.setSeed(rand());
 
+	// the notes in the backpack refer to guests by guest id and
+	// are stamped with the game minute
+	m_backpack.setGuests(&m_guests);
+	m_backpack.setClock(&m_minute);
+
+	// a prebuilt room is built straight from its layout
+	if (setup == NO_ROOM)
+	{
+		return;
+	}
 	// set up an empty room represented by Space pointers to
 	// Floor objects
 	setEmptyRoom();
+	// a saved game fills in the rest of the room itself
+	if (setup == EMPTY_ROOM)
+	{
+		return;
+	}
 	// create and place the guests in the room (along with the
 	// thief)
 	createGuests(NUM_GUESTS);	
 	placeGuests();	
+	pinCulprits();
 	// set all of the remaining Spaces for the room
 	setClues();	
 	setStereo();
@@ -88,6 +151,51 @@ ThiefGame::ThiefGame()
 	// place the player randomly in the room on an empty floor
 	// space
 	placePlayer();	
+
+	startParty();
+}
+
+/*****************************************************************
+Helper method to the constructor. Tells the backpack and the crowd
+which guests are the culprits: the backpack checks guesses against
+the culprits' guest ids, and the culprits are steered on their own
+when guests wander. No parameters and no return value.
+*****************************************************************/
+
+void ThiefGame::pinCulprits()
+{
+	std::vector<int> culpritIds;
+	for (Space* culprit : m_culprits)
+	{
+		int culpritId = dynamic_cast<Person*>(culprit)->getId();
+		culpritIds.push_back(culpritId);
+		m_crowd.setPinned(culpritId, true);
+	}
+	m_backpack.setCulprits(culpritIds);
+}
+
+/*****************************************************************
+Helper method to the constructor. Starts the party once the room
+is set up: the changes made while setting up the room are dropped
+and the end of the party and the guests that leave early are 
+scheduled. No parameters and no return value.
+*****************************************************************/
+
+void ThiefGame::startParty()
+{
+	// the first map is always drawn in full, so the set up of
+	// the room does not need to be tracked as changes
+	clearDirty();
+
+	// schedule the end of the party and the guests that leave
+	// early
+	m_partyEndTimer = m_timers.schedule(m_endMinute, 
+		TimerWheel::PARTY_END, 0);
+	for (int leaveTime : GUEST_LEAVE_TIMES)
+	{
+		m_timers.schedule(START_MINUTE + leaveTime,
+			TimerWheel::GUEST_LEAVES, 0);
+	}
 }
 
 /*****************************************************************
@@ -103,10 +211,14 @@ void ThiefGame::setEmptyRoom()
 	for (int i = 0; i < NUM_ROWS; i++)
 	{
 		m_rowStart[i] = new Floor();
+		m_rowStart[i]->setPosition(i, 0);
+		m_cells[i * NUM_COLS] = m_rowStart[i];
 		Space* curSpace = m_rowStart[i];
 		for (int j = 0; j < NUM_COLS - 1; j++)
 		{
 			Space* rightFloor = new Floor();
+			rightFloor->setPosition(i, j + 1);
+			m_cells[i * NUM_COLS + j + 1] = rightFloor;
 			curSpace->setRight(rightFloor);
 			rightFloor->setLeft(curSpace);
 			curSpace = rightFloor;
@@ -128,56 +240,129 @@ void ThiefGame::setEmptyRoom()
 	}
 }
 
+/*****************************************************************
+Builds the room from a prebuilt layout (see RoomLayout.hpp) in a
+single pass: each cell gets the Space for its tile straight away,
+rather than starting as floor and being replaced, and no random
+floor has to be searched for. The guests are added to the guest 
+table in the order of the layout's guest table, and its first 
+guests are the culprits. The layout has already been checked 
+when it was opened, so it is not checked again. The single 
+parameter is the layout and the method has no return value.
+*****************************************************************/
+
+void ThiefGame::setLayoutRoom(const RoomLayout &layout)
+{
+	// the spaces without any fields of their own
+	for (int cell = 0; cell < NUM_CELLS; cell++)
+	{
+		switch (layout.getTile(cell))
+		{
+			case RoomLayout::STEREO:
+			{
+				m_cells[cell] = new Stereo();
+				break;
+			}
+			case RoomLayout::LAUNCHER:
+			{
+				m_cells[cell] = new Launcher();
+				break;
+			}
+			case RoomLayout::FIREWORKS:
+			{
+				m_cells[cell] = new FireworksBox();
+				break;
+			}
+			case RoomLayout::TRUTH_CANDY:
+			{
+				m_cells[cell] = new TruthCandyBox();
+				break;
+			}
+			case RoomLayout::FLOOR:
+			{
+				m_cells[cell] = new Floor();
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+	}
+
+	// the guests and clues are made from the guest and clue tables,
+	// which hold a cell for each of them
+	for (int i = 0; i < layout.numGuests(); i++)
+	{
+		const RoomLayout::Guest &guest = layout.getGuest(i);
+		m_cells[guest.cell] = new Person(&m_guests, 
+			m_guests.add(guest.rosterEntry));
+	}
+	for (int i = 0; i < layout.numClues(); i++)
+	{
+		const RoomLayout::Clue &clue = layout.getClue(i);
+		MsgId clueMsg = clue.letterClue 
+			? (clue.group ? MSG_GROUP_LETTER : MSG_CLUE_LETTER)
+			: (clue.group ? MSG_GROUP_GENDER : MSG_CLUE_GENDER);
+		Message clueInfo{ clueMsg };
+		clueInfo.male = clue.male;
+		clueInfo.letter = clue.letterClue ? clue.letter : ' ';
+		m_cells[clue.cell] = new Clue(clueInfo);
+	}
+
+	// link every space to the spaces around it
+	for (int row = 0; row < NUM_ROWS; row++)
+	{
+		m_rowStart[row] = m_cells[row * NUM_COLS];
+		for (int col = 0; col < NUM_COLS; col++)
+		{
+			int cell = row * NUM_COLS + col;
+			Space* curSpace = m_cells[cell];
+			curSpace->setPosition(row, col);
+			curSpace->setUp(row > 0 ? m_cells[cell - NUM_COLS] : nullptr);
+			curSpace->setDown(row < NUM_ROWS - 1 
+				? m_cells[cell + NUM_COLS] : nullptr);
+			curSpace->setLeft(col > 0 ? m_cells[cell - 1] : nullptr);
+			curSpace->setRight(col < NUM_COLS - 1 
+				? m_cells[cell + 1] : nullptr);
+			track(curSpace);
+			// wandering guests gather around the stereo
+			if (layout.getTile(cell) == RoomLayout::STEREO)
+			{
+				m_crowd.setAttractor(row, col);
+			}
+		}
+	}
+
+	for (int i = 0; i < layout.numCulprits(); i++)
+	{
+		m_culprits.push_back(m_cells[layout.getGuest(i).cell]);
+	}
+	setPlayerSpace(m_cells[layout.getPlayerCell()]);
+}
+
 /*****************************************************************
 Helper method to the constructor. Creates all of the party guests
 for the party. Takes as a parameter the number of guests to add
 to the room. Returns true if the number of guests are created 
 and false otherwise. Only the maximum number of guests will be
 created if the number of guests parameter is too large (i.e. there 
-are not enough names available to give the guests). The method 
-randomly chooses identities of the guests. The method is 
-currently designed to allow for up to 20 guests.
+are not enough guests in the guest roster). The method randomly 
+chooses the guests from the roster (see GuestRoster.hpp).
 *****************************************************************/
 
 bool ThiefGame::createGuests(int numGuests)
 {
-	std::vector<std::pair<std::string, bool>> possibleGuests{
-		std::make_pair(std::string("Bill"), true),
-		std::make_pair(std::string("Charles"), true),
-		std::make_pair(std::string("Ethan"), true),
-		std::make_pair(std::string("Sebastian"), true),
-		std::make_pair(std::string("Xavier"), true),
-		std::make_pair(std::string("Zachary"), true),
-		std::make_pair(std::string("Reuben"), true),
-		std::make_pair(std::string("Wesley"), true),
-		std::make_pair(std::string("Maximus"), true),
-		std::make_pair(std::string("Alec"), true),
-		std::make_pair(std::string("Ophelia"), false),
-		std::make_pair(std::string("Violet"), false), 
-		std::make_pair(std::string("Isabella"), false),
-		std::make_pair(std::string("Penelope"), false),
-		std::make_pair(std::string("Nora"), false),
-		std::make_pair(std::string("Hannah"), false),
-		std::make_pair(std::string("Lola"), false),
-		std::make_pair(std::string("Georgia"), false),
-		std::make_pair(std::string("Jasmine"), false),
-		std::make_pair(std::string("Diana"), false)
-	};	
-
-	while (numGuests > 0 && possibleGuests.size() > 0)
-	{
-		int guestIndex = getRand(0, possibleGuests.size() - 1);	
-		auto guestInfo = possibleGuests[guestIndex];
-		Space* nextGuest = new Person(guestInfo.first, guestInfo.second);
-		m_guestList.push_back(nextGuest);
-		numGuests--;
-
-		// remove the added guest from the remaining possible guests to 
-		// add 
-		std::swap(possibleGuests[guestIndex], 
-			possibleGuests[possibleGuests.size() - 1]);	
-		possibleGuests.pop_back();	
+	// the guests are chosen from the shared roster and added to
+	// the guest table. Their names stay in the roster, so no names
+	// are copied.
+	GuestRoster& roster = GuestRoster::shared();
+	int numChosen = roster.sample(numGuests);
+	for (int i = 0; i < numChosen; i++)
+	{
+		m_guests.add(roster.sampled(i));
 	}
+	numGuests -= numChosen;
 
 	// indicate if the total # of requested guests could not be 
 	// added
@@ -191,27 +376,33 @@ bool ThiefGame::createGuests(int numGuests)
 
 /*****************************************************************
 Helper method to the constructor. The method places the party
-guests in the room. The method takes no parameters and has no
-return value. Also determines which guest will be the thief.
+guests in the room, with a Person space for each guest in the 
+guest table. The method takes no parameters and has no return 
+value. Also determines which guests will be the culprits.
 *****************************************************************/
 
 void ThiefGame::placeGuests()
 {
-	// determine the index of the thief
-	int thiefInd = getRand(0, m_guestList.size() - 1);
-	for (int i = 0; i < m_guestList.size(); i++)
+	// choose the culprits at random, with a partial shuffle of
+	// the guest ids
+	int numGuests = m_guests.size();
+	int numCulprits = std::min(m_options.numCulprits, numGuests);
+	std::vector<int> guestIds(numGuests);
+	std::iota(guestIds.begin(), guestIds.end(), 0);
+	for (int i = 0; i < numCulprits; i++)
+	{
+		std::swap(guestIds[i], guestIds[getRand(i, numGuests - 1)]);
+	}
+
+	for (int guestId = 0; guestId < numGuests; guestId++)
 	{		
 		// place the guest in the randomly selected location
-		bool isThief = (i == thiefInd);
-		if (isThief)
-		{
-			m_thief = m_guestList[i];
-		}
-		place(m_guestList[i], isThief);	
+		place(new Person(&m_guests, guestId));	
+	}
+	for (int i = 0; i < numCulprits; i++)
+	{
+		m_culprits.push_back(m_cells[m_guests.getCell(guestIds[i])]);
 	}
-	// rearrange m_guestList so the thief pointer is stored at
-	// the first index
-	std::swap(m_guestList[thiefInd], m_guestList[0]); 
 }
 
 /*****************************************************************
@@ -222,14 +413,19 @@ parameter is greater than the max parameter, then the values
 are swapped (so a random value is still returned).
 *****************************************************************/
 
-int ThiefGame::getRand(int min, int max) const
+int ThiefGame::getRand(int min, int max)
 {
 	if (min > max)
 	{
 		std::swap(min, max);
 	}
 	
-	return (rand() % (max - min + 1)) + min;
+	// the game keeps its own xorshift generator so that a saved
+	// game carries on with the same random numbers
+	m_randState ^= m_randState << 13;
+	m_randState ^= m_randState >> 17;
+	m_randState ^= m_randState << 5;
+	return (m_randState % (max - min + 1)) + min;
 }
 
 /*****************************************************************
@@ -238,13 +434,12 @@ chosen spot is not empty Floor space, then the Space object is placed
 on the next empty Floor space. The first parameter is a pointer
 to the Space object, the second parameter is the row in which 
 the object will be placed, the third parameter is the column 
-in which the object will be placed, and the last parameter 
-holds true if the space is that of the thief and false otherwise.
+in which the object will be placed.
 *****************************************************************/
 
-void ThiefGame::place(Space* newSpace, bool isThief)
+void ThiefGame::place(Space* newSpace)
 {
-	Space* randFloor = getRandFloor(isThief);
+	Space* randFloor = getRandFloor();
 	
 	replace(randFloor, newSpace);	
 }
@@ -253,11 +448,68 @@ void ThiefGame::place(Space* newSpace, bool isThief)
 Replaces one space with another space. The first parameter is 
 a pointer to the Space that will be replaced and the second
 parameter is a pointer to the Space that will be the 
-replacement. No return value.
+replacement. The old space is freed. No return value.
 *****************************************************************/
 
 void ThiefGame::replace(Space* oldSpace, Space* newSpace)
 {
+	link(oldSpace, newSpace);
+
+	// keep the guest index and the crowd in step with the guests
+	// in the room
+	Person* oldGuest = dynamic_cast<Person*>(oldSpace);
+	if (oldGuest != nullptr)
+	{
+		m_guestIndex.remove(oldGuest->getId());
+		m_crowd.remove(oldGuest->getId());
+	}
+	track(newSpace);
+
+	// free memory associated with the old space
+	delete oldSpace;
+}
+
+/*****************************************************************
+Records a Space that has just been put in the room with the guest
+table, the guest index and the crowd: a guest is added at its 
+cell, and any other space blocks the crowd unless it is floor
+(guests can't step onto anything but floor). The single parameter
+is the Space and the method has no return value.
+*****************************************************************/
+
+void ThiefGame::track(Space* newSpace)
+{
+	int row = newSpace->getRow();
+	int col = newSpace->getCol();
+	Person* newGuest = dynamic_cast<Person*>(newSpace);
+	if (newGuest != nullptr)
+	{
+		m_guests.setCell(newGuest->getId(), row * NUM_COLS + col);
+		m_guestIndex.add(newGuest->getId(), row, col);
+		m_crowd.add(newGuest->getId(), row, col);
+	}
+	else
+	{
+		m_crowd.setBlocked(row, col, 
+			newSpace->getType() != Floor::statType());
+	}
+}
+
+/*****************************************************************
+Puts a space in the place of another space in the room: the new
+space takes over the location of the old space and the pointers
+to and from the spaces around it. The first parameter is the old
+Space (which is not freed) and the second parameter is the new 
+Space. No return value.
+*****************************************************************/
+
+void ThiefGame::link(Space* oldSpace, Space* newSpace)
+{
+	// the new space takes over the location of the old space
+	newSpace->setPosition(oldSpace->getRow(), oldSpace->getCol());
+	m_cells[newSpace->getRow() * NUM_COLS + newSpace->getCol()] = newSpace;
+	markDirty(newSpace);
+
 	// set all of the new pointers between the new space
 	// and surrounding spaces of the old space
 	Space* adjacentSpace = oldSpace->getUp();
@@ -288,528 +540,1650 @@ void ThiefGame::replace(Space* oldSpace, Space* newSpace)
 		adjacentSpace->setRight(newSpace);
 	}
 
-	// need to check if the old space was the start of a 
-	// row, in which case the rowStart needs to be modified
-	bool foundRStart = false;
-	int i = 0;
-	while (!foundRStart && i < NUM_ROWS)
+	// if the old space was the start of a row then the rowStart
+	// needs to be modified
+	if (newSpace->getCol() == 0)
+	{
+		m_rowStart[newSpace->getRow()] = newSpace;
+	}
+}
+
+/*****************************************************************
+Adds a note to the player's notepad and sends it to the event 
+stream (if there is one). The note is stamped with the current 
+game minute. Empty notes (FACT_NONE) are ignored. The single 
+parameter is the note and the method has no return value.
+*****************************************************************/
+
+void ThiefGame::takeNote(Fact note)
+{
+	if (note.kind == FACT_NONE)
+	{
+		return;
+	}
+
+	note.minute = m_minute;
+	m_backpack.addNote(note);
+	if (m_events != nullptr)
+	{
+		m_events->note(formatMessage(factMessage(note, m_guests)));
+	}
+}
+
+/*****************************************************************
+Sends every cell that changed since the room was last drawn to the
+event stream, followed by the player location (if the player 
+moved) and the current time. The changed cells are then cleared.
+No parameters and no return value.
+*****************************************************************/
+
+void ThiefGame::endFrame()
+{
+	if (m_events != nullptr)
 	{
-		if (m_rowStart[i] == oldSpace)
+		int playerCell = m_playerSpace->getRow() * NUM_COLS 
+			+ m_playerSpace->getCol();
+		for (int cell : m_dirtyCells)
+		{
+			m_events->tile(cell, m_cells[cell]->getSymbol());
+		}
+		if (m_dirtyMask.test(playerCell))
 		{
-			m_rowStart[i] = newSpace;
-			foundRStart = true;
+			m_events->player(playerCell);
 		}
-		i++;
+		m_events->clock(m_minute % MINS_PER_DAY);
+		m_events->flush();
 	}
+	clearDirty();
+}
 
-	// free memory associated with the old space
-	delete oldSpace;
+/*****************************************************************
+Sends the size of the room, every cell, the player location and 
+the current time to the event stream (if there is one). Used at 
+the start of a game. No parameters and no return value.
+*****************************************************************/
+
+void ThiefGame::publishRoom()
+{
+	if (m_events == nullptr)
+	{
+		return;
+	}
+
+	m_events->gameStart(NUM_ROWS, NUM_COLS);
+	for (int cell = 0; cell < NUM_CELLS; cell++)
+	{
+		m_events->tile(cell, m_cells[cell]->getSymbol());
+	}
+	m_events->player(m_playerSpace->getRow() * NUM_COLS 
+		+ m_playerSpace->getCol());
+	m_events->clock(m_minute % MINS_PER_DAY);
+	m_events->flush();
 }
 
 /*****************************************************************
-Helper method to the constructor.
-Sets the clues in the room. The method takes no parameters and
-has no return value. The locations of the clues are chosen 
-randomly, but must be on an empty floor space.
+Records that the cell holding the given Space has changed since
+the room was last drawn. A cell is only added to the dirty list
+once between calls to clearDirty. No return value.
 *****************************************************************/
 
-void ThiefGame::setClues()
+void ThiefGame::markDirty(const Space* spc)
 {
-	// set clue indicating the gender of the thief
-	std::string gendClueStr{ "The thief is " };
-	Person* thiefPtr = dynamic_cast<Person*>(m_thief);	
-	if (thiefPtr->isMale())
+	int cell = spc->getRow() * NUM_COLS + spc->getCol();
+	if (!m_dirtyMask.test(cell))
 	{
-		gendClueStr += "male.";
+		m_dirtyMask.set(cell);
+		m_dirtyCells.push_back(cell);
 	}
-	else
+}
+
+/*****************************************************************
+Moves the player to the given Space. Both the cell the player
+leaves and the cell the player enters are marked as changed. No
+return value.
+*****************************************************************/
+
+void ThiefGame::setPlayerSpace(Space* newSpace)
+{
+	if (m_playerSpace != nullptr)
 	{
-		gendClueStr += "female.";
-	}	
-	Space* genderClue = new Clue(gendClueStr);
-	place(genderClue, false);
+		markDirty(m_playerSpace);
+	}
+	m_playerSpace = newSpace;
+	markDirty(m_playerSpace);
 
-	// set clue indicating a letter in the name of the thief
-	std::string nameClueStr{ "The thief's name contains the letter " };	
-	std::string thiefName = thiefPtr->getName();
-	int letterInd = getRand(0, thiefName.length() - 1);
+	// the field is updated a step at a time as the player moves
+	if (m_options.movingGuests)
+	{
+		m_playerField.setSource(m_playerSpace->getRow(),
+			m_playerSpace->getCol());
+	}
+}
 
-	nameClueStr += "'"; 
-	nameClueStr += tolower(thiefName[letterInd]); 
-	nameClueStr += "'.";
+/*****************************************************************
+Returns the cells that have changed since the room was last 
+drawn. Each cell is represented as row * NUM_COLS + col and 
+appears at most once, in the order the changes happened.
+*****************************************************************/
 
-	Space* nameClue = new Clue(nameClueStr);
-	place(nameClue, false); 		
+const std::vector<int>& ThiefGame::getDirtyCells() const
+{
+	return m_dirtyCells;
 }
 
 /*****************************************************************
-Helper method to the constructor.
-Sets one stereo in the room. The method takes no parameters and
-has no return value. The location for the stereo is chosen
-randomly.
+Sets the stream that the events of the game are written to. The
+stream is not owned by the game, and passing nullptr turns the 
+events off. No return value.
 *****************************************************************/
 
-void ThiefGame::setStereo()
+void ThiefGame::setEventStream(EventStream* events)
 {
-	Space* partyStereo = new Stereo();
-	place(partyStereo, false);
+	m_events = events;
 }
 
 /*****************************************************************
-Helper method to the constructor.
-Sets one launcher in the room. The method takes no parameters and
-has no return value. The location for the launcher is chosen
-randomly.
+Empties the list of changed cells. The method takes no parameters
+and has no return value.
 *****************************************************************/
 
-void ThiefGame::setLauncher()
+void ThiefGame::clearDirty()
 {
-	Space* partyLauncher = new Launcher();
-	place(partyLauncher, false);
+	for (int cell : m_dirtyCells)
+	{
+		m_dirtyMask.reset(cell);
+	}
+	m_dirtyCells.clear();
 }
 
+/*****************************************************************
+Sets the journal the game is written to as it is played (see
+GameJournal.hpp). The journal is not owned by the game, and passing
+nullptr turns journaling off. No return value.
+*****************************************************************/
+
+void ThiefGame::setJournal(GameJournal* journal)
+{
+	m_journal = journal;
+}
 
 /*****************************************************************
-Helper method to the constructor.
-Sets the fireworks box in the room. The method takes no
-parameters and has no return value. The location for the fireworks
-box is chosen randomly.
+Writes the turn to the journal (if there is one). A new snapshot
+starts the journal again when the parameter is true or when enough
+minutes have passed since the last snapshot; otherwise the input
+entered during the turn is committed. No snapshot is taken while
+commands typed ahead are still queued, since the rest of their 
+line was journaled before the snapshot. No return value.
 *****************************************************************/
 
-void ThiefGame::setFireworks()
+void ThiefGame::checkpoint(bool force)
 {
-	Space* fworksBox = new FireworksBox();
-	place(fworksBox, false);
+	if (m_journal == nullptr)
+	{
+		return;
+	}
+
+	if ((force || m_minute >= m_checkpointMinute + CHECKPOINT_MINUTES)
+		&& !m_gameFinished && !inputQueued())
+	{
+		std::vector<unsigned char> snapshot;
+		save(snapshot);
+		if (m_journal->addSnapshot(snapshot))
+		{
+			m_checkpointMinute = m_minute;
+		}
+	}
+	m_journal->commit();
 }
 
 /*****************************************************************
-Helper method to the constructor.
-Sets the truth candy box in the room. The method takes no 
-parameters and has no return value. The location for the truth
-candy box is chosen randomly.
+Sets the file the player can save the game to from the main menu.
+Passing nullptr turns saving off. The path is not copied, so it
+must outlive the game. No return value.
 *****************************************************************/
 
-void ThiefGame::setTruthCandy()
+void ThiefGame::setSaveFile(const char* path)
 {
-	Space* tCandyBox = new TruthCandyBox();
-	place(tCandyBox, false);
+	m_saveFile = path;
 }
 
 /*****************************************************************
-Method that sets the space on which the player is placed. The 
-space is chosen at random but must be an empty floor space. The
-method takes no parameters and has no return value.
+Returns true once the game is finished (the police have arrived
+or the culprits have escaped).
 *****************************************************************/
 
-void ThiefGame::placePlayer()
+bool ThiefGame::isFinished() const
 {
-	m_playerSpace = getRandFloor(false);
+	return m_gameFinished;
 }
 
 /*****************************************************************
-Finds a random floor space and returns a pointer to that space. 
-The method takes a bool parameter. If the parameter is set to 
-true that indicates this is the floor space on which the thief
-will be placed. In this case the method also sets the row and 
-column of the thief.
+Creates a game in a prebuilt room. The first parameter is the 
+game settings and the second is the layout of the room, which 
+must be the size of the room. The number of culprits comes from
+the layout. The room is built from the layout (see setLayoutRoom)
+and the layout is not kept, so it can be shared by any number of
+games. Returns the new game (owned by the caller), or nullptr if
+the layout does not fit the game.
 *****************************************************************/
 
-Space* ThiefGame::getRandFloor(bool isThief) 
+ThiefGame* ThiefGame::fromLayout(const GameOptions &options, 
+	const RoomLayout &layout)
 {
-	int placeRow = getRand(0, NUM_ROWS - 1);
-	int placeCol = getRand(0, NUM_COLS - 1);	
+	if (layout.getRows() != NUM_ROWS || layout.getCols() != NUM_COLS
+		|| layout.numCulprits() > CulpritSolver::MAX_CULPRITS)
+	{
+		return nullptr;
+	}
 
-	Space* curSpace = m_rowStart[placeRow];
-	for (int i = 1; i <= placeCol; i++)
+	GameOptions layoutOptions = options;
+	layoutOptions.numCulprits = layout.numCulprits();
+	ThiefGame* game = new ThiefGame(layoutOptions, NO_ROOM);
+	game->setLayoutRoom(layout);
+	game->pinCulprits();
+	game->startParty();
+	return game;
+}
+
+/*****************************************************************
+Returns the tile (see RoomLayout.hpp) for the kind of the Space
+passed as the parameter. Used to save the room.
+*****************************************************************/
+
+RoomLayout::Tile ThiefGame::tileOf(const Space* spc)
+{
+	if (dynamic_cast<const Person*>(spc) != nullptr)
 	{
-		curSpace = curSpace->getRight();
+		return RoomLayout::PERSON;
 	}
-	
-	int curRow = placeRow;
-	int curCol = placeCol;
-	
-	// move to the next space while a blank floor space hasn't yet 
-	// been found
-	while (curSpace->getType() != Floor::statType())
+	if (dynamic_cast<const Clue*>(spc) != nullptr)
 	{
-		if (curCol == NUM_COLS - 1)
+		return RoomLayout::CLUE;
+	}
+	if (dynamic_cast<const Stereo*>(spc) != nullptr)
+	{
+		return RoomLayout::STEREO;
+	}
+	if (dynamic_cast<const Launcher*>(spc) != nullptr)
+	{
+		return RoomLayout::LAUNCHER;
+	}
+	if (dynamic_cast<const FireworksBox*>(spc) != nullptr)
+	{
+		return RoomLayout::FIREWORKS;
+	}
+	if (dynamic_cast<const TruthCandyBox*>(spc) != nullptr)
+	{
+		return RoomLayout::TRUTH_CANDY;
+	}
+	return RoomLayout::FLOOR;
+}
+
+/*****************************************************************
+Writes the room of the game, as it is now, as a prebuilt layout
+file (see RoomLayout.hpp), so that a room set up at random can be
+kept and reused. Only the guests still at the party are written,
+with the culprits first. The single parameter is the path of the
+file. Returns true if the file was written.
+*****************************************************************/
+
+bool ThiefGame::writeLayout(const char* path) const
+{
+	std::vector<unsigned char> tiles(NUM_CELLS);
+	std::vector<RoomLayout::Guest> guests;
+	std::vector<RoomLayout::Clue> clues;
+	for (const Space* culprit : m_culprits)
+	{
+		int culpritId = dynamic_cast<const Person*>(culprit)->getId();
+		guests.push_back(RoomLayout::Guest{ 
+			std::uint32_t(m_guests.getRosterEntry(culpritId)),
+			std::uint32_t(m_guests.getCell(culpritId)) });
+	}
+
+	for (int cell = 0; cell < NUM_CELLS; cell++)
+	{
+		tiles[cell] = tileOf(m_cells[cell]);
+		if (tiles[cell] == RoomLayout::PERSON && !isCulprit(m_cells[cell]))
 		{
-			if (curRow == NUM_ROWS - 1)
+			int guestId = dynamic_cast<const Person*>(m_cells[cell])->getId();
+			guests.push_back(RoomLayout::Guest{
+				std::uint32_t(m_guests.getRosterEntry(guestId)),
+				std::uint32_t(cell) });
+		}
+		else if (tiles[cell] == RoomLayout::CLUE)
+		{
+			const Message &clueInfo = 
+				dynamic_cast<const Clue*>(m_cells[cell])->getClue();
+			RoomLayout::Clue clue;
+			clue.cell = cell;
+			clue.letterClue = clueInfo.id == MSG_CLUE_LETTER 
+				|| clueInfo.id == MSG_GROUP_LETTER;
+			clue.group = clueInfo.id == MSG_GROUP_GENDER 
+				|| clueInfo.id == MSG_GROUP_LETTER;
+			clue.male = clueInfo.male;
+			clue.letter = clueInfo.letter;
+			clues.push_back(clue);
+		}
+	}
+
+	return RoomLayout::write(path, NUM_ROWS, NUM_COLS, tiles, guests,
+		m_culprits.size(), clues, 
+		m_playerSpace->getRow() * NUM_COLS + m_playerSpace->getCol());
+}
+
+/*****************************************************************
+Adds a snapshot of the complete state of the game to the vector 
+passed as the parameter. The format is described in Snapshot.hpp.
+Only what can't be rebuilt is saved: the guests' names come from 
+the guest roster, and the guest index, the crowd's cells, the
+distance field and the menus are all rebuilt as the room is filled
+back in. No return value.
+*****************************************************************/
+
+void ThiefGame::save(std::vector<unsigned char> &snapshot) const
+{
+	SnapshotWriter out(snapshot);
+	out.putBytes(SNAPSHOT_MAGIC, MAGIC_LENGTH);
+	out.putVarint(SNAPSHOT_VERSION);
+
+	out.putVarint(m_options.minuteMs);
+	out.putVarint(m_options.backpackSlots);
+	out.putVarint(m_options.movingGuests);
+	out.putVarint(m_options.numCulprits);
+
+	out.putVarint(m_randState);
+	out.putVarint(m_crowd.getSeed());
+
+	out.putInt(m_minute);
+	out.putInt(m_endMinute);
+	out.putVarint(m_gameFinished);
+	out.putVarint(m_correctGuess);
+
+	out.putVarint(m_guests.size());
+	for (int guestId = 0; guestId < m_guests.size(); guestId++)
+	{
+		out.putVarint(m_guests.getRosterEntry(guestId));
+		out.putVarint(m_guests.getFlags(guestId));
+	}
+
+	out.putVarint(m_culprits.size());
+	for (const Space* culprit : m_culprits)
+	{
+		out.putVarint(dynamic_cast<const Person*>(culprit)->getId());
+	}
+
+	out.putVarint(NUM_ROWS);
+	out.putVarint(NUM_COLS);
+	for (const Space* cell : m_cells)
+	{
+		RoomLayout::Tile tile = tileOf(cell);
+		out.putVarint(tile);
+		if (tile == RoomLayout::PERSON)
+		{
+			out.putVarint(dynamic_cast<const Person*>(cell)->getId());
+		}
+		else if (tile == RoomLayout::CLUE)
+		{
+			const Message &clue = dynamic_cast<const Clue*>(cell)->getClue();
+			out.putVarint(clue.id);
+			out.putVarint(clue.male);
+			out.putVarint(static_cast<unsigned char>(clue.letter));
+		}
+		else if (tile == RoomLayout::STEREO)
+		{
+			out.putVarint(dynamic_cast<const Stereo*>(cell)->powerOn());
+		}
+	}
+
+	out.putVarint(m_playerSpace->getRow() * NUM_COLS 
+		+ m_playerSpace->getCol());
+
+	// the party end and police arrival timers are marked so their
+	// handles can be found again after loading
+	std::vector<int> handles;
+	m_timers.pending(handles);
+	out.putVarint(handles.size());
+	for (int handle : handles)
+	{
+		const TimerWheel::Timer &timer = m_timers.getTimer(handle);
+		int role = 0;
+		if (handle == m_policeTimer && timer.event == TimerWheel::POLICE_ARRIVE)
+		{
+			role = 2;
+		}
+		else if (handle == m_partyEndTimer 
+			&& timer.event == TimerWheel::PARTY_END)
+		{
+			role = 1;
+		}
+		out.putInt(timer.minute);
+		out.putVarint(timer.event);
+		out.putInt(timer.arg);
+		out.putVarint(role);
+	}
+
+	m_backpack.save(out);
+}
+
+/*****************************************************************
+Creates a game from a snapshot made by save. The first parameter
+is the snapshot and the second is its length in bytes. The game is
+set up with the saved options and an empty room, which is then
+filled in from the snapshot. Returns the new game (to be freed by
+the caller), or nullptr if the snapshot is not a valid snapshot
+of this version made with the same guest roster.
+*****************************************************************/
+
+ThiefGame* ThiefGame::load(const unsigned char* data, std::size_t size)
+{
+	static constexpr unsigned int MAX_MINUTE_MS = 60 * 1000;
+
+	SnapshotReader in(data, size);
+	if (!in.expectBytes(SNAPSHOT_MAGIC, MAGIC_LENGTH) 
+		|| in.getVarint() != SNAPSHOT_VERSION)
+	{
+		return nullptr;
+	}
+
+	GameOptions options;
+	options.minuteMs = in.getAtMost(MAX_MINUTE_MS);
+	options.backpackSlots = in.getAtMost(std::numeric_limits<int>::max());
+	options.movingGuests = in.getAtMost(1) != 0;
+	options.numCulprits = in.getAtMost(CulpritSolver::MAX_CULPRITS);
+	if (!in.ok() || options.backpackSlots < 1 || options.numCulprits < 1)
+	{
+		return nullptr;
+	}
+
+	ThiefGame* game = new ThiefGame(options, EMPTY_ROOM);
+	if (!game->restore(in) || !in.atEnd())
+	{
+		delete game;
+		return nullptr;
+	}
+	return game;
+}
+
+/*****************************************************************
+Helper method to load. Restores the state of the game (after the
+options) from a snapshot into a game with an empty room. The 
+room is filled in through replace, so the guest index and the 
+crowd are rebuilt along the way. Every value is checked before it
+is used, and the single parameter (the reader) is failed at the
+first value that is not valid. Returns true if the game was 
+restored.
+*****************************************************************/
+
+bool ThiefGame::restore(SnapshotReader &in)
+{
+	m_randState = in.getVarint();
+	m_crowd.setSeed(in.getVarint());
+	m_minute = in.getInt();
+	m_endMinute = in.getInt();
+	m_gameFinished = in.getAtMost(1) != 0;
+	m_correctGuess = in.getAtMost(1) != 0;
+	if (m_randState == 0)
+	{
+		in.fail();
+	}
+
+	// the guests, which must come from the same guest roster
+	GuestRoster& roster = GuestRoster::shared();
+	int numGuests = in.getAtMost(roster.size());
+	for (int guestId = 0; guestId < numGuests && in.ok(); guestId++)
+	{
+		int entry = in.getAtMost(roster.size() - 1);
+		unsigned char flags = in.getAtMost(GuestTable::MALE 
+			| GuestTable::MET | GuestTable::LEFT);
+		if (!in.ok())
+		{
+			break;
+		}
+		m_guests.add(entry);
+		if ((flags & GuestTable::MALE) != (m_guests.getFlags(guestId) 
+			& GuestTable::MALE))
+		{
+			in.fail();
+		}
+		if (flags & GuestTable::MET)
+		{
+			m_guests.setMet(guestId);
+		}
+		if (flags & GuestTable::LEFT)
+		{
+			m_guests.setLeft(guestId);
+		}
+	}
+
+	int numCulprits = in.getAtMost(m_options.numCulprits);
+	std::vector<int> culpritIds;
+	for (int i = 0; i < numCulprits && in.ok(); i++)
+	{
+		int culpritId = in.getAtMost(numGuests - 1);
+		if (std::find(culpritIds.begin(), culpritIds.end(), culpritId)
+			!= culpritIds.end())
+		{
+			in.fail();
+		}
+		culpritIds.push_back(culpritId);
+	}
+	if (numGuests == 0 || numCulprits == 0 || in.getVarint() != NUM_ROWS 
+		|| in.getVarint() != NUM_COLS)
+	{
+		in.fail();
+	}
+
+	// fill in the room. Each guest still at the party must be in
+	// exactly one cell.
+	std::vector<bool> placed(numGuests, false);
+	for (int cell = 0; cell < NUM_CELLS && in.ok(); cell++)
+	{
+		Space* tile = nullptr;
+		switch (in.getAtMost(RoomLayout::NUM_TILES - 1))
+		{
+			case RoomLayout::PERSON:
+			{
+				int guestId = in.getAtMost(numGuests - 1);
+				if (!in.ok() || placed[guestId] 
+					|| m_guests.hasLeft(guestId))
+				{
+					in.fail();
+					break;
+				}
+				placed[guestId] = true;
+				tile = new Person(&m_guests, guestId);
+				break;
+			}
+			case RoomLayout::CLUE:
+			{
+				Message clue{ static_cast<MsgId>(in.getVarint()) };
+				clue.male = in.getAtMost(1) != 0;
+				clue.letter = in.getAtMost('z');
+				if (clue.id != MSG_CLUE_GENDER && clue.id != MSG_CLUE_LETTER
+					&& clue.id != MSG_GROUP_GENDER 
+					&& clue.id != MSG_GROUP_LETTER)
+				{
+					in.fail();
+					break;
+				}
+				tile = new Clue(clue);
+				break;
+			}
+			case RoomLayout::STEREO:
+			{
+				tile = new Stereo(in.getAtMost(1) != 0);
+				break;
+			}
+			case RoomLayout::LAUNCHER:
+			{
+				tile = new Launcher();
+				break;
+			}
+			case RoomLayout::FIREWORKS:
+			{
+				tile = new FireworksBox();
+				break;
+			}
+			case RoomLayout::TRUTH_CANDY:
+			{
+				tile = new TruthCandyBox();
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+
+		if (tile != nullptr)
+		{
+			replace(m_cells[cell], tile);
+			// wandering guests gather around the stereo
+			if (dynamic_cast<Stereo*>(tile) != nullptr)
+			{
+				m_crowd.setAttractor(tile->getRow(), tile->getCol());
+			}
+		}
+	}
+	for (int guestId = 0; guestId < numGuests && in.ok(); guestId++)
+	{
+		if (placed[guestId] == m_guests.hasLeft(guestId))
+		{
+			in.fail();
+		}
+	}
+	if (!in.ok())
+	{
+		return false;
+	}
+
+	// the culprits are found from their cells, as when the game
+	// was first set up
+	for (int culpritId : culpritIds)
+	{
+		if (m_guests.hasLeft(culpritId))
+		{
+			return false;
+		}
+		m_culprits.push_back(m_cells[m_guests.getCell(culpritId)]);
+	}
+	pinCulprits();
+
+	setPlayerSpace(m_cells[in.getAtMost(NUM_CELLS - 1)]);
+
+	// the timers are scheduled again in the order they fire, so 
+	// timers due in the same minute still fire in the same order.
+	// There must be a single party end timer at the end time, and
+	// at most one police arrival timer, which must match the 
+	// player's guess.
+	int numTimers = in.getVarint();
+	for (int i = 0; i < numTimers && in.ok(); i++)
+	{
+		int minute = in.getInt();
+		unsigned int event = in.getAtMost(TimerWheel::THIEF_SLIPS_OUT);
+		int arg = in.getInt();
+		int role = in.getAtMost(2);
+		bool valid = minute > m_minute && event >= TimerWheel::PARTY_END;
+		if (event == TimerWheel::ITEM_RESPAWN)
+		{
+			valid = valid && arg >= 0 && arg < NUM_ITEMS;
+		}
+		else if (event == TimerWheel::THIEF_SLIPS_OUT)
+		{
+			valid = valid && arg >= 0 && arg < numCulprits;
+		}
+		if (event == TimerWheel::PARTY_END)
+		{
+			valid = valid && role == 1 && minute == m_endMinute
+				&& m_partyEndTimer == TimerWheel::NO_TIMER;
+		}
+		else if (event == TimerWheel::POLICE_ARRIVE)
+		{
+			valid = valid && role == 2 && arg == m_correctGuess
+				&& m_policeTimer == TimerWheel::NO_TIMER;
+		}
+		else
+		{
+			valid = valid && role == 0;
+		}
+		if (!in.ok() || !valid)
+		{
+			in.fail();
+			break;
+		}
+
+		int handle = m_timers.schedule(minute, 
+			static_cast<TimerWheel::TimerEvent>(event), arg);
+		if (event == TimerWheel::PARTY_END)
+		{
+			m_partyEndTimer = handle;
+		}
+		else if (event == TimerWheel::POLICE_ARRIVE)
+		{
+			m_policeTimer = handle;
+		}
+	}
+	if (m_partyEndTimer == TimerWheel::NO_TIMER 
+		|| (m_correctGuess && m_policeTimer == TimerWheel::NO_TIMER))
+	{
+		in.fail();
+	}
+
+	if (!in.ok() || !m_backpack.restore(in))
+	{
+		return false;
+	}
+
+	// the first map is always drawn in full
+	clearDirty();
+	m_resumed = true;
+	return true;
+}
+
+/*****************************************************************
+Saves the game to the save file and tells the player. The game is
+marked as resumed, so running it again carries on from where it
+was saved. Returns true if the game was saved.
+*****************************************************************/
+
+bool ThiefGame::saveGame()
+{
+	std::vector<unsigned char> snapshot;
+	save(snapshot);
+	if (!writeSnapshotFile(m_saveFile, snapshot))
+	{
+		say(Message{ MSG_SAVE_FAILED });
+		return false;
+	}
+
+	m_resumed = true;
+	say(Message{ MSG_GAME_SAVED });
+	return true;
+}
+
+/*****************************************************************
+Helper method to the constructor.
+Sets the clues in the room. The method takes no parameters and
+has no return value. The locations of the clues are chosen 
+randomly, but must be on an empty floor space.
+*****************************************************************/
+
+void ThiefGame::setClues()
+{
+	// with more than one culprit, each clue describes one of them
+	// without saying which
+	bool group = m_culprits.size() > 1;
+	for (Space* culprit : m_culprits)
+	{
+		// set clue indicating the gender of the culprit
+		Person* thiefPtr = dynamic_cast<Person*>(culprit);	
+		Message gendClue{ group ? MSG_GROUP_GENDER : MSG_CLUE_GENDER };
+		gendClue.male = thiefPtr->isMale();
+		Space* genderClue = new Clue(gendClue);
+		place(genderClue);
+
+		// set clue indicating a letter in the name of the culprit
+		std::string_view thiefName = thiefPtr->getName();
+		int letterInd = getRand(0, thiefName.length() - 1);
+		Message letterClue{ group ? MSG_GROUP_LETTER : MSG_CLUE_LETTER };
+		letterClue.letter = tolower(thiefName[letterInd]); 
+
+		Space* nameClue = new Clue(letterClue);
+		place(nameClue); 		
+	}
+}
+
+/*****************************************************************
+Helper method to the constructor.
+Sets one stereo in the room. The method takes no parameters and
+has no return value. The location for the stereo is chosen
+randomly.
+*****************************************************************/
+
+void ThiefGame::setStereo()
+{
+	Space* partyStereo = new Stereo();
+	place(partyStereo);
+	// wandering guests gather around the stereo
+	m_crowd.setAttractor(partyStereo->getRow(), partyStereo->getCol());
+}
+
+/*****************************************************************
+Helper method to the constructor.
+Sets one launcher in the room. The method takes no parameters and
+has no return value. The location for the launcher is chosen
+randomly.
+*****************************************************************/
+
+void ThiefGame::setLauncher()
+{
+	Space* partyLauncher = new Launcher();
+	place(partyLauncher);
+}
+
+
+/*****************************************************************
+Helper method to the constructor.
+Sets the fireworks box in the room. The method takes no
+parameters and has no return value. The location for the fireworks
+box is chosen randomly.
+*****************************************************************/
+
+void ThiefGame::setFireworks()
+{
+	Space* fworksBox = new FireworksBox();
+	place(fworksBox);
+}
+
+/*****************************************************************
+Helper method to the constructor.
+Sets the truth candy box in the room. The method takes no 
+parameters and has no return value. The location for the truth
+candy box is chosen randomly.
+*****************************************************************/
+
+void ThiefGame::setTruthCandy()
+{
+	Space* tCandyBox = new TruthCandyBox();
+	place(tCandyBox);
+}
+
+/*****************************************************************
+Method that sets the space on which the player is placed. The 
+space is chosen at random but must be an empty floor space. The
+method takes no parameters and has no return value.
+*****************************************************************/
+
+void ThiefGame::placePlayer()
+{
+	setPlayerSpace(getRandFloor());
+}
+
+/*****************************************************************
+Finds a random floor space and returns a pointer to that space. 
+The player's space is never chosen. The method takes no 
+parameters.
+*****************************************************************/
+
+Space* ThiefGame::getRandFloor() 
+{
+	int placeRow = getRand(0, NUM_ROWS - 1);
+	int placeCol = getRand(0, NUM_COLS - 1);	
+
+	Space* curSpace = m_rowStart[placeRow];
+	for (int i = 1; i <= placeCol; i++)
+	{
+		curSpace = curSpace->getRight();
+	}
+	
+	int curRow = placeRow;
+	int curCol = placeCol;
+	
+	// move to the next space while a blank floor space (other than
+	// the one the player is on) hasn't yet been found
+	while (curSpace->getType() != Floor::statType() 
+		|| curSpace == m_playerSpace)
+	{
+		if (curCol == NUM_COLS - 1)
+		{
+			if (curRow == NUM_ROWS - 1)
+			{
+				curSpace = m_rowStart[0];
+				curRow = 0;
+				curCol = 0; 		
+			}
+			else
+			{
+				curRow++;
+				curCol = 0;
+				curSpace = m_rowStart[curRow];
+			}
+		}
+		else
+		{
+			curSpace = curSpace->getRight();
+			curCol++;
+		}
+	}
+
+	return curSpace;
+}
+
+/*****************************************************************
+Returns true if the Space passed as the parameter is one of the
+culprits.
+*****************************************************************/
+
+bool ThiefGame::isCulprit(const Space* spc) const
+{
+	return std::find(m_culprits.begin(), m_culprits.end(), spc) 
+		!= m_culprits.end();
+}
+
+/*****************************************************************
+Presents the player with the information about the game at the
+start of a new game: the end time, the map symbols (which are also
+written in the notepad) and the commands. The method takes no 
+parameters and has no return value.
+*****************************************************************/
+
+void ThiefGame::introduce()
+{
+	// the map symbols, which are also written in the notepad
+	static constexpr MsgId symbolsInfo[]{ MSG_SYMBOL_PLAYER, 
+		MSG_SYMBOL_PERSON, MSG_SYMBOL_FIREWORKS, MSG_SYMBOL_CLUE,
+		MSG_SYMBOL_TRUTH_CANDY, MSG_SYMBOL_STEREO, MSG_SYMBOL_LAUNCHER,
+		MSG_SYMBOL_MET }; 
+
+	// present player with information about the game
+	Message gameInfo{ MSG_GAME_INFO };
+	gameInfo.time = m_endMinute;
+	say(Message{ MSG_WELCOME });
+	say(gameInfo);
+	if (m_culprits.size() > 1)
+	{
+		Message accompliceInfo{ MSG_ACCOMPLICE_INFO };
+		accompliceInfo.count = m_culprits.size();
+		say(accompliceInfo);
+	}
+
+	if (m_options.minuteMs > 0)
+	{
+		double seconds = m_options.minuteMs / 1000.0;
+		std::cout << "\nThis is a real-time game: each minute of the "
+			<< "party lasts " << seconds
+			<< (seconds == 1 ? " second" : " seconds") 
+			<< ",\nwhether or not you move.\n";
+	}
+
+	std::cout << "\nEnter '1' to continue:\n";
+	intValid(1, 1);
+
+	say(Message{ MSG_MAP_INFO });
+	for (MsgId info : symbolsInfo)
+	{
+		sayLine(Message{ info });
+
+		Fact symbolNote{ FACT_MAP_SYMBOL };
+		symbolNote.value = info - MSG_SYMBOL_PLAYER;
+		takeNote(symbolNote);
+	}
+	say(Message{ MSG_NOTE_INFO });
+	say(Message{ MSG_COMMAND_INFO });
+
+	std::cout << "\nEnter '1' to start the game:\n";
+	intValid(1, 1);
+}
+
+/*****************************************************************
+Runs a full find the thief game. If the game for this instance
+has already been completed, the method does nothing and returns
+false. Otherwise, the method completes a single game and returns
+true.
+*****************************************************************/
+
+bool ThiefGame::runGame() 
+{
+	if (m_gameFinished)
+	{
+		return false;
+	}
+
+	// viewers are sent the starting room before anything else
+	publishRoom();
+
+	// a game that was saved carries on where it left off
+	if (m_resumed)
+	{
+		Message resumeInfo{ MSG_GAME_RESUMED };
+		resumeInfo.time = m_endMinute;
+		say(resumeInfo);
+	}
+	else
+	{
+		introduce();
+	}
+
+	const std::string moveChoice{ "Make move for the turn" };
+	const std::string backpackChoice{ "Open your backpack" };
+	Menu mainMenu;
+	mainMenu.addOption(moveChoice, 'm');
+	mainMenu.addOption(backpackChoice, 'b');
+	if (m_saveFile)
+	{
+		mainMenu.addOption("Save the game and leave the party", 's');
+	}
+
+	enum MainChoice {
+		MOVE = 1,
+		BACKPACK,
+		SAVE
+	};
+
+	// the party clock starts running once the game starts
+	m_nextTick = std::chrono::steady_clock::now() 
+		+ std::chrono::milliseconds(m_options.minuteMs);
+
+	// the journal starts from the game as it is now and records
+	// every line the player enters from here on
+	if (m_journal != nullptr)
+	{
+		checkpoint(true);
+		setInputRecorder([this](std::string_view line)
+			{
+				m_journal->addInput(line);
+			});
+	}
+
+	// a resumed game was left after the player interacted with
+	// their space, so the interaction isn't repeated
+	bool interacted = m_resumed;
+	
+	while(!m_gameFinished)
+	{
+		printTime();
+		printRoom();
+		// the map has just been drawn, so send the changes to the
+		// viewers and start tracking the changes made this turn
+		endFrame();
+
+		// interact with the current space. Nothing happens if on
+		// a Floor space
+		if (!interacted)
+		{
+			interact();	
+		}
+		interacted = false;
+
+		// the turn is written to the journal before the player
+		// chooses what to do next
+		checkpoint(false);
+
+		std::cout << "\n";		
+		MainChoice playerChoice = 
+			static_cast<MainChoice>(chooseTimed(mainMenu));
+
+		while (playerChoice != MOVE && !m_gameFinished)
+		{
+			// the player leaves a saved game, to come back to it later
+			if (playerChoice == SAVE)
+			{
+				if (saveGame())
+				{
+					endFrame();
+					clearQueuedInput();
+					setInputRecorder(nullptr);
+					return true;
+				}
+				std::cout << "\n";
+				playerChoice = 
+					static_cast<MainChoice>(chooseTimed(mainMenu));
+				continue;
+			}
+
+			// player opens backpack, return value indicates the game state
+			BPResult gameState = m_backpack.open(m_playerSpace);
+
+			switch (gameState.outcome) {
+				case BPResult::WRONG_GUESS:
+				{
+					policeCalled(false);
+					break;
+				}
+				case BPResult::CORRECT_GUESS:
+				{
+					policeCalled(true);
+					break;
+				}
+				case BPResult::USED_ITEM:
+				{
+					useItem(gameState.item);
+					break;
+				}
+				default:
+				{
+					break;
+				}
+			}			
+	
+			if (!m_gameFinished)	
+			{
+				std::cout << "\n";
+				playerChoice = 
+					static_cast<MainChoice>(chooseTimed(mainMenu));
+			}
+		}	
+
+		if (!m_gameFinished)
+		{
+			// choose the move menu for the turn based on where the
+			// player can currently move. This is done just before
+			// moving since the spaces around the player can change
+			// while the clock runs.
+			Space* moveChoices[NUM_DIRS];
+			const Menu& moveMenu = setMoveMenu(moveChoices);
+
+			// perform movement
+			movePlayer(moveMenu, moveChoices);	
+			// in the turn based game every move takes a minute. In
+			// the real-time game the clock is moved on by clockTick.
+			if (m_options.minuteMs == 0)
+			{
+				addMin();
+				moveGuests();
+				runTimers();
+			}
+		}
+	}
+
+	// send the final state of the room to the viewers
+	endFrame();
+
+	// any commands typed ahead past the end of the game are dropped
+	clearQueuedInput();
+	setInputRecorder(nullptr);
+	
+	return true;
+}
+
+/*****************************************************************
+Moves the guests on by a minute if guests are set to wander (see
+GameOptions). The crowd works out which guests step where, and 
+each guest that steps swaps places with the empty floor space it
+steps onto. The method takes no parameters and has no return 
+value.
+*****************************************************************/
+
+void ThiefGame::moveGuests()
+{
+	if (!m_options.movingGuests)
+	{
+		return;
+	}
+
+	m_crowd.step(m_playerSpace->getRow(), m_playerSpace->getCol(),
+		m_crowdMoves);
+	for (const Crowd::Move &move : m_crowdMoves)
+	{
+		moveGuest(m_cells[move.fromCell], m_cells[move.toCell]);
+	}
+	for (Space* culprit : m_culprits)
+	{
+		moveCulprit(culprit);
+	}
+}
+
+/*****************************************************************
+Moves a guest onto an empty floor space. The guest leaves empty
+floor behind and takes the place of the floor space, which is 
+freed. The guest index is updated (the crowd is updated by the 
+caller). The first parameter is the guest and the second is the
+floor space. No return value.
+*****************************************************************/
+
+void ThiefGame::moveGuest(Space* guest, Space* dest)
+{
+	link(guest, new Floor());
+	link(dest, guest);
+	delete dest;
+
+	int guestId = dynamic_cast<Person*>(guest)->getId();
+	m_guests.setCell(guestId, guest->getRow() * NUM_COLS + guest->getCol());
+	m_guestIndex.move(guestId, guest->getRow(), guest->getCol());
+}
+
+/*****************************************************************
+A culprit keeps away from the player when guests wander. Once the
+player is within THIEF_ALERT_DISTANCE steps, the culprit steps 
+onto whichever empty floor space next to it is furthest from the
+player, giving up a little distance to keep away from the clues.
+The distances come from the player's distance field, which is 
+updated as the player moves. The culprit stays put while the 
+player is talking to them. The single parameter is the culprit
+and the method has no return value.
+*****************************************************************/
+
+void ThiefGame::moveCulprit(Space* culprit)
+{
+	if (m_playerSpace == culprit)
+	{
+		return;
+	}
+
+	m_playerField.setSource(m_playerSpace->getRow(), 
+		m_playerSpace->getCol());
+	int thiefDist = m_playerField.distance(culprit->getRow(), 
+		culprit->getCol());
+	if (thiefDist > THIEF_ALERT_DISTANCE)
+	{
+		return;
+	}
+
+	Space* best = nullptr;
+	int bestScore = thiefDist - CLUE_AVOIDANCE * cluesNextTo(culprit);
+	Space* steps[NUM_DIRS] = { culprit->getUp(), culprit->getRight(),
+		culprit->getDown(), culprit->getLeft() };
+	for (Space* step : steps)
+	{
+		if (step == nullptr || step == m_playerSpace 
+			|| step->getType() != Floor::statType())
+		{
+			continue;
+		}
+
+		int score = m_playerField.distance(step->getRow(), step->getCol())
+			- CLUE_AVOIDANCE * cluesNextTo(step);
+		if (score > bestScore)
+		{
+			best = step;
+			bestScore = score;
+		}
+	}
+
+	if (best != nullptr)
+	{
+		int row = best->getRow();
+		int col = best->getCol();
+		moveGuest(culprit, best);
+		m_crowd.moveTo(dynamic_cast<Person*>(culprit)->getId(), row, col);
+	}
+}
+
+/*****************************************************************
+Returns the number of clue spaces next to (above, below, left or
+right of) the Space passed as the parameter.
+*****************************************************************/
+
+int ThiefGame::cluesNextTo(const Space* spc) const
+{
+	int numClues = 0;
+	const Space* around[NUM_DIRS] = { spc->getUp(), spc->getRight(),
+		spc->getDown(), spc->getLeft() };
+	for (const Space* next : around)
+	{
+		if (next != nullptr && next->getType() == Clue::statType())
+		{
+			numClues++;
+		}
+	}
+	return numClues;
+}
+
+/*****************************************************************
+Runs every event scheduled for the current game minute, in the
+order they were scheduled. Events due after the game has finished
+are not run. The method takes no parameters and has no return 
+value.
+*****************************************************************/
+
+void ThiefGame::runTimers()
+{
+	m_timers.advance(m_minute, m_firedTimers);
+	for (const TimerWheel::Timer &timer : m_firedTimers)
+	{
+		if (m_gameFinished)
+		{
+			break;
+		}
+
+		switch (timer.event)
+		{
+			case TimerWheel::PARTY_END:
+			{
+				m_partyEndTimer = TimerWheel::NO_TIMER;
+				partyEnd();
+				break;
+			}
+			case TimerWheel::GUEST_LEAVES:
+			{
+				guestLeaves();
+				break;
+			}
+			case TimerWheel::ITEM_RESPAWN:
+			{
+				respawnItem(timer.arg);
+				break;
+			}
+			case TimerWheel::POLICE_ARRIVE:
 			{
-				curSpace = m_rowStart[0];
-				curRow = 0;
-				curCol = 0; 		
+				m_policeTimer = TimerWheel::NO_TIMER;
+				policeArrive(timer.arg != 0);
+				break;
 			}
-			else
+			case TimerWheel::THIEF_SLIPS_OUT:
 			{
-				curRow++;
-				curCol = 0;
-				curSpace = m_rowStart[curRow];
+				thiefSlipsOut(timer.arg);
+				break;
 			}
 		}
-		else
-		{
-			curSpace = curSpace->getRight();
-			curCol++;
-		}
 	}
-
-	if (isThief)
-	{	
-		m_thiefRow = curRow;
-		m_thiefCol = curCol;
-	}
-	return curSpace;
 }
 
 /*****************************************************************
-Runs a full find the thief game. If the game for this instance
-has already been completed, the method does nothing and returns
-false. Otherwise, the method completes a single game and returns
-true.
+The party has reached its end time. If the police are already on
+their way they arrive as the party ends. Otherwise the player is
+forced to call the police at the last minute (the game also ends 
+if the player has not met anyone to name). The method takes no 
+parameters and has no return value.
 *****************************************************************/
 
-bool ThiefGame::runGame() 
+void ThiefGame::partyEnd()
 {
-	if (m_gameFinished)
+	if (m_policeTimer != TimerWheel::NO_TIMER)
 	{
-		return false;
+		m_timers.cancel(m_policeTimer);
+		m_policeTimer = TimerWheel::NO_TIMER;
+		policeArrive(m_correctGuess);
+		return;
 	}
 
-	// game information strings
-	const std::string welcomeMsg{ "\nWelcome to the Find the "
-		"Thief Game!\n" };
-	const std::string gameInfo{ "\nYou are at a party and realize"
-		" that someone has stolen your wallet.\nYou need to figure"
-		" out who the thief is and call the police before\nthe party"
-		" is over. You need to guess the identity of the thief "
-		"correctly\nthe first time because the thief will leave if "
-		"the police arrive to\nquestion someone else. The party "
-		"ends at 11:30PM, so you must\ncall the police before the "
-		"party is over. Meet the guests of\nthe party, pick up clues,"
-		" and use items in the room to help find\nthe thief.\n"};
-
-	const std::string mapInfo{ "\nFor each turn of the game you"
-		" will be shown a map of the room. The symbols on\nthe map "
-		"have the following meanings:\n"
-	};
-
-	const std::string starInfo{ "* - your location in the room" };
-	const std::string PInfo{ "P - a person that you have not yet"
-		" met"};
-	const std::string FInfo{ "F - a box of fireworks. You can move to "
-		"this box to pick up fireworks" };
-	const std::string CInfo{ "C - a clue. This will give you a hint "
-		"regarding the identity of the thief" };
-	const std::string TInfo { "T - a box of truth candy bars. You can "
-		"move to this box to pick up a truth\ncandy bar" };
-	const std::string SInfo { "S - a stereo. You can play songs on the"
-		" stereo that have different effects on\nthe party" };
-	const std::string LInfo{ "L - a launcher. Can be used to quickly "
-		"launch yourself to other parts of the\nroom" };	
-	const std::string lCaseInfo{ "a, b, c, ... - lower case letters"
-		" represent the first letters of the names of\npeople that"
-		" you have already met" };
-
-	const std::string noteInfo{ "\nAll of this information is also"
-		" written in your notepad for reference.\n" };	
-
-	const std::vector<std::string> symbolsInfo{ starInfo, PInfo,
-		FInfo, CInfo, TInfo, SInfo, LInfo, lCaseInfo }; 
-
-	// present player with information about the game
-	std::cout << welcomeMsg
-			  << gameInfo;
-
-	std::cout << "\nEnter '1' to continue:\n";
-	intValid(1, 1);
-
-	std::cout << mapInfo;
-	for (std::string info : symbolsInfo)
+	say(Message{ MSG_LAST_MINUTE_CALL });
+	int endVal = m_backpack.callPolice();
+	if (endVal == 0)
 	{
-		std::cout << info << "\n";
-		m_backpack.addNote(info);
+		say(Message{ MSG_NO_CALL_MADE });
+		m_gameFinished = true;
+		if (m_events != nullptr)
+		{
+			m_events->gameEnd(false);
+		}
 	}
-	std::cout << noteInfo;
+	else
+	{
+		say(Message{ MSG_POLICE_ARRIVE });
+		policeArrive(endVal == 1);
+	}	
+}
 
-	std::cout << "\nEnter '1' to start the game:\n";
-	intValid(1, 1);
+/*****************************************************************
+The player has named a guest to the police. The single parameter
+holds true if the guest named is the thief. In the turn based game
+the police arrive straight away. In the real-time game they arrive
+a few minutes later, and if the right guest was named the thief
+(or one of the culprits, chosen at random) tries to slip out of
+the party before then. No return value.
+*****************************************************************/
 
-	const std::string moveChoice{ "Make move for the turn" };
-	const std::string backpackChoice{ "Open your backpack" };
-	Menu mainMenu;
-	mainMenu.addOption(moveChoice);
-	mainMenu.addOption(backpackChoice);
+void ThiefGame::policeCalled(bool correctGuess)
+{
+	if (m_options.minuteMs <= 0)
+	{
+		say(Message{ MSG_POLICE_ARRIVE });
+		policeArrive(correctGuess);
+		return;
+	}
 
-	enum MainChoice {
-		MOVE = 1,
-		BACKPACK
-	};
+	Message onTheWay{ MSG_POLICE_ON_THE_WAY };
+	onTheWay.time = m_minute + POLICE_DELAY;
+	say(onTheWay);
 
-	// represents the possible return values of opening the
-	// backpack
-	enum BPResult {
-		WRONG_GUESS = 0,
-		NO_ACTION,
-		CORRECT_GUESS,
-		FIREWORKS,
-		TRUTH_CANDY			
-	};
-	
-	while(!m_gameFinished)
+	m_correctGuess = correctGuess;
+	m_policeTimer = m_timers.schedule(m_minute + POLICE_DELAY,
+		TimerWheel::POLICE_ARRIVE, correctGuess);
+	if (correctGuess)
 	{
-		std::cout << "\nCurrent time: ";
-		printTime();
-		printRoom();
+		m_timers.schedule(m_minute + getRand(1, POLICE_DELAY - 1),
+			TimerWheel::THIEF_SLIPS_OUT, 
+			getRand(0, m_culprits.size() - 1));
+	}
+}
 
-		// interact with the current space. Nothing happens if on
-		// a Floor space
-		interact();	
+/*****************************************************************
+The police arrive at the party and question the guest the player
+named. The single parameter holds true if the guest named is the
+thief. The game ends. No return value.
+*****************************************************************/
 
-		// create move menu for the turn based on where the player
-		// can currently move
-		Menu moveMenu;
-		std::vector<Space*> moveChoices;
-		setMoveMenu(moveMenu, moveChoices);
+void ThiefGame::policeArrive(bool correctGuess)
+{
+	if (m_options.minuteMs > 0)
+	{
+		say(Message{ MSG_POLICE_HERE });
+	}
 
-		std::cout << "\n";		
-		MainChoice playerChoice = 
-			static_cast<MainChoice>(mainMenu.chooseOption());
+	if (correctGuess)
+	{
+		gameWin();
+	}
+	else
+	{
+		gameLoss();
+	}
+}
 
-		while (playerChoice != MOVE && !m_gameFinished)
-		{
-			// player opens backpack, return value indicates the game state
-			BPResult gameState = 
-				static_cast<BPResult>(m_backpack.open(m_playerSpace));
+/*****************************************************************
+A culprit tries to slip out of the party before the police 
+arrive. The culprit stays if the player is on or next to the 
+culprit's space, otherwise the culprit escapes and the game is 
+lost. The single parameter is the place of the culprit in the
+list of culprits. The method has no return value.
+*****************************************************************/
 
-			switch (gameState) {
-				case WRONG_GUESS:
-				{
-					gameLoss();
-					break;
-				}
-				case CORRECT_GUESS:
-				{
-					gameWin();
-					break;
-				}
-				case FIREWORKS:
-				{
-					useFireworks();
-					break;
-				}
-				case TRUTH_CANDY:
-				{
-					useTruthCandy();
-					break;
-				}
-				default:
-				{
-					break;
-				}
-			}			
-	
-			if (!m_gameFinished)	
-			{
-				std::cout << "\n";
-				playerChoice = 
-					static_cast<MainChoice>(mainMenu.chooseOption());
-			}
-		}	
+void ThiefGame::thiefSlipsOut(int culpritInd)
+{
+	Space* culprit = m_culprits[culpritInd];
+	Person* thiefPtr = dynamic_cast<Person*>(culprit);
+	Message slipMsg{ MSG_THIEF_WATCHED };
+	slipMsg.name = thiefPtr->getNameId();
+	slipMsg.male = thiefPtr->isMale();
+
+	bool watched = m_playerSpace == culprit
+		|| m_playerSpace == culprit->getUp()
+		|| m_playerSpace == culprit->getRight()
+		|| m_playerSpace == culprit->getDown()
+		|| m_playerSpace == culprit->getLeft();
+	if (watched)
+	{
+		say(slipMsg);
+		return;
+	}
 
-		if (!m_gameFinished)
-		{
-			// perform movement
-			movePlayer(moveMenu, moveChoices);	
-			// increment the time by a minute
-			addMin();
-		}
+	slipMsg.id = MSG_THIEF_ESCAPED;
+	say(slipMsg);
 
-		// check to see if this is the end time, if so, force the player
-		// to call the police now
-		if (!m_gameFinished && m_hour == m_endHour && m_min == m_endMin
-			&& m_isAM == m_endAM) 
-		{
-			std::cout << "\nThe party is ending, so you call the police "
-				<< "at the last minute!\n";
-			int endVal = m_backpack.callPolice();
-			if (endVal == 0)
-			{
-				std::cout << "\nYou decided against calling the police"
-					<< " as you have no clue as to who stole your wallet!\n"
-					<< "The thief leaves along with the rest of the guests "
-					<< "as the party ends.\n";
-			}
-			else if (endVal == -1)
-			{
-				gameLoss();
-			}
-			else
-			{
-				gameWin();
-			}	
-		}
+	m_gameFinished = true;
+	if (m_events != nullptr)
+	{
+		m_events->gameEnd(false);
 	}
-	
-	return true;
 }
 
 /*****************************************************************
-Prints the current game time to the console. The method takes
-no paramters and has no return value.
+A single guest leaves the party early. The guest is chosen at 
+random but cannot be a culprit or the guest the player is 
+talking to. The method takes no parameters and has no return 
+value.
 *****************************************************************/
 
-void ThiefGame::printTime() const
-{	
-	std::cout << m_hour << ":" << m_min;
-	if (m_isAM)
-	{
-		std::cout << "AM\n";
-	}
-	else
+void ThiefGame::guestLeaves()
+{
+	std::vector<int> leavingGuests;
+	findLeavingGuests(leavingGuests);
+	if (leavingGuests.empty())
 	{
-		std::cout << "PM\n";
+		return;
 	}
-}
 
+	std::cout << "\n";
+	removeGuest(leavingGuests[getRand(0, leavingGuests.size() - 1)]);
+}
 
 /*****************************************************************
-Prints a given time to the console. Takes three
-parameters. The first parameter represents the hour as a string, 
-the second parameter represents the minute as a string and the 
-last parameter is a bool value that holds true if the time is in 
-the AM and false if the time is in the PM. The method returns as
-a string the same information that is printed to the console.
+A box of fireworks or truth candy bars is brought back to a 
+random empty floor space after being picked up. The single 
+parameter is the item (an ItemId). No return value.
 *****************************************************************/
 
-std::string ThiefGame::printTime(std::string hour, std::string min, 
-	bool isAM) const
+void ThiefGame::respawnItem(int item)
 {
-	std::string timeInfo = hour + ":" + min;	
-	if (isAM)
+	if (item == FIREWORKS_ITEM_ID)
 	{
-		timeInfo += "AM";	
+		setFireworks();
 	}
 	else
 	{
-		timeInfo += "PM";	
+		setTruthCandy();
 	}
-	std::cout << timeInfo << "\n";
-	return timeInfo;
 }
 
 /*****************************************************************
-Adds a minute to the current game time. The method takes no 
-parameters and has no return value.
+Moves the party clock on by a minute in the real-time game and 
+prints the new time. Any events due at the new time are run, so
+the party may end as a result. The method 
+takes no parameters and has no return value.
 *****************************************************************/
 
-void ThiefGame::addMin() 
+void ThiefGame::clockTick()
 {
-	addMin(m_hour, m_min, m_isAM);
+	addMin();
+	printTime();
+	if (m_events != nullptr)
+	{
+		m_events->clock(m_minute % MINS_PER_DAY);
+		m_events->flush();
+	}
+	moveGuests();
+	runTimers();
 }
 
 /*****************************************************************
-Adds a minute to a given time for by modifying the 
-variables representing the time. The method has no return value
-and has three reference parameters (representing the hour, 
-the minute, and a bool value that is set to true if the time is
-currently in the AM).
+Prompts the player with the menu passed as the parameter and 
+returns the number of the option chosen. In the turn based game 
+this is the same as calling chooseOption on the menu. In the 
+real-time game the party clock keeps running while the method 
+waits for input: a minute passes each time the wall clock reaches
+the next tick. If the game ends while waiting, 0 is returned.
 *****************************************************************/
 
-void ThiefGame::addMin(std::string &hour, std::string &min,
-	bool &isAM) 
+int ThiefGame::chooseTimed(const Menu &menu)
 {
-	// special handling if the time is about to enter new hour
-	if(min == "59")
+	if (m_options.minuteMs <= 0)
+	{
+		return menu.chooseOption();
+	}
+
+	int choice = 0;
+	if (menu.queuedOption(choice))
 	{
-		if (hour == "12")
+		return choice;
+	}
+	menu.printOptions();
+
+	const std::chrono::milliseconds minuteLength(m_options.minuteMs);
+	while (true)
+	{
+		// catch up on every minute that has passed, including
+		// time spent in other prompts
+		std::chrono::steady_clock::time_point now = 
+			std::chrono::steady_clock::now();
+		bool ticked = false;
+		while (!m_gameFinished && now >= m_nextTick)
 		{
-			hour = "01";
+			m_nextTick += minuteLength;
+			clockTick();
+			ticked = true;
 		}
-		else if (hour == "11")
+		if (m_gameFinished)
 		{
-			hour = "12";
-			isAM = !isAM;
+			return 0;
 		}
-		else
+		// the input journaled after a snapshot is replayed without
+		// the clock running, so every minute starts a new snapshot
+		if (ticked)
 		{
-			int hourInt = std::stoi(hour);
-			hourInt++;
-			std::string newHourStr = "";
-			if (hourInt < 10)
-			{
-				newHourStr += "0";
-			}
-			newHourStr += std::to_string(hourInt);
-			hour = newHourStr;
+			checkpoint(true);
 		}
-		min = "00";
-	}
 
-	// normal case where minute is added, but it is not a new hour
-	else
-	{
-		int minInt = std::stoi(min);
-		minInt++;
-		std::string newMinStr = "";
-		if (minInt < 10)
+		// the option is only read once a whole line has arrived, so
+		// a partial line does not stop the clock
+		int waitMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+			m_nextTick - now).count() + 1;
+		if (waitForInput(waitMs))
 		{
-			newMinStr += "0";
+			return menu.readOption();
 		}
-		newMinStr += std::to_string(minInt);	
-		min = newMinStr;	
-	}		
+	}
+}
+
+/*****************************************************************
+Prints the current game time to the console, on a line of its 
+own. The method takes no paramters and has no return value.
+*****************************************************************/
+
+void ThiefGame::printTime() const
+{	
+	Message timeMsg{ MSG_TIME };
+	timeMsg.time = m_minute;
+	say(timeMsg);
+}
+
+/*****************************************************************
+Adds a minute to the current game time. The method takes no 
+parameters and has no return value.
+*****************************************************************/
+
+void ThiefGame::addMin() 
+{
+	m_minute++;
 }
 
 /*****************************************************************
-Method that builds the move menu for the player based upon the
-players current location. The method takes as reference parameters
-the Menu that will be built and a vector of space pointers in 
-which the possible move choices will be stored.
+Method that chooses the move menu for the player based upon the
+players current location. There is one menu for each combination
+of open directions and the menus are only built the first time the
+method is called. The single parameter is an array in which the
+possible move choices will be stored (in the same order as the 
+menu options). The method returns a reference to the menu.
 *****************************************************************/
 
-void ThiefGame::setMoveMenu(Menu &moveMenu, 
-	std::vector<Space*> &moveChoices) const
+const Menu& ThiefGame::setMoveMenu(Space* moveChoices[NUM_DIRS]) const
 {
+	// bit values for each direction in the menu index
+	static constexpr int UP_BIT{ 1 };
+	static constexpr int RIGHT_BIT{ 2 };
+	static constexpr int DOWN_BIT{ 4 };
+	static constexpr int LEFT_BIT{ 8 };
+
+	static Menu moveMenus[NUM_MOVE_MENUS];
+	static bool menusBuilt = false;
+	if (!menusBuilt)
+	{
+		for (int mask = 0; mask < NUM_MOVE_MENUS; mask++)
+		{
+			if (mask & UP_BIT)
+			{
+				moveMenus[mask].addOption("Move up", 'u');
+			}
+			if (mask & RIGHT_BIT)
+			{
+				moveMenus[mask].addOption("Move right", 'r');
+			}
+			if (mask & DOWN_BIT)
+			{
+				moveMenus[mask].addOption("Move down", 'd');
+			}
+			if (mask & LEFT_BIT)
+			{
+				moveMenus[mask].addOption("Move left", 'l');
+			}
+		}
+		menusBuilt = true;
+	}
+
+	int mask = 0;
+	int numChoices = 0;
 	if (m_playerSpace->getUp() != nullptr)
 	{
-		moveMenu.addOption("Move up");
-		moveChoices.push_back(m_playerSpace->getUp());
+		mask |= UP_BIT;
+		moveChoices[numChoices++] = m_playerSpace->getUp();
 	}
 	if (m_playerSpace->getRight() != nullptr)
 	{
-		moveMenu.addOption("Move right");
-		moveChoices.push_back(m_playerSpace->getRight());
+		mask |= RIGHT_BIT;
+		moveChoices[numChoices++] = m_playerSpace->getRight();
 	}
 	if (m_playerSpace->getDown() != nullptr)
 	{
-		moveMenu.addOption("Move down");
-		moveChoices.push_back(m_playerSpace->getDown());
+		mask |= DOWN_BIT;
+		moveChoices[numChoices++] = m_playerSpace->getDown();
 	}
 	if (m_playerSpace->getLeft() != nullptr)
 	{
-		moveMenu.addOption("Move left");
-		moveChoices.push_back(m_playerSpace->getLeft());
+		mask |= LEFT_BIT;
+		moveChoices[numChoices++] = m_playerSpace->getLeft();
 	}
+
+	return moveMenus[mask];
 }
 
 /*****************************************************************
 Prompts the player with a menu to move and performs the movement
 based on the player's choice. The method takes as a parameter the
 move menu with which to prompt the player as a reference and as
-a second parameter a vector of Spaces representing the possible
+a second parameter an array of Spaces representing the possible
 Spaces the player can move (in the same order as presented in 
-the menu). The method has no return value.
+the menu). If the menu has no moves the player stays where they
+are. The method has no return value.
 *****************************************************************/
 
 void ThiefGame::movePlayer(const Menu &moveMenu, 
-	const std::vector<Space*> &moveChoices)
+	Space* const moveChoices[NUM_DIRS])
 {
-	std::cout << "\nChoose which direction to move.\n";
+	// chooseOption returns -1 for a menu with no options, which
+	// is not a move
+	if (moveMenu.getNumOptions() == 0)
+	{
+		return;
+	}
+
+	if (!inputQueued())
+	{
+		std::cout << "\nChoose which direction to move.\n";
+	}
 	int choice = moveMenu.chooseOption();
 	// have to subtract one from the choice because the choice
 	// return values start at 1 rather than 0
-	m_playerSpace = moveChoices[choice - 1];
+	setPlayerSpace(moveChoices[choice - 1]);
 }
 
 /*****************************************************************
@@ -869,18 +2243,11 @@ return value.
 void ThiefGame::performEvent()
 {	
 	std::string eventType = m_playerSpace->event();
-	// make sure backpack has info on who thief is (to check when police
-	// are called if player guess is correct)
-	if (m_playerSpace == m_thief)
-	{
-		Person* thiefPtr = dynamic_cast<Person*>(m_thief);
-		m_backpack.setThief(thiefPtr->getName());
-	}
 
 	if (eventType == Person::statType())
 	{
 		Person* guestPtr = dynamic_cast<Person*>(m_playerSpace);
-		m_backpack.addContact(guestPtr->getName());
+		m_backpack.addContact(guestPtr->getId());
 	}
 
 	else if (eventType == Stereo::statType())
@@ -898,15 +2265,14 @@ void ThiefGame::performEvent()
 			randGuestsLeave();
 			std::cout << "Enter '1' to continue:\n";
 			intValid(1, 1);
-			std::cout << "\nNew map of the room following the exodus:\n";
+			say(Message{ MSG_EXODUS_MAP });
 			printRoom();
 		}
 		else if (stereoVal == GOOD_MUSIC)
 		{
 			// extend the game time by 15 minutes
 			static constexpr int addedMins{ 15 };
-			std::cout << "The excitement of the guests causes the "
-				<< "party to last longer!\n";
+			say(Message{ MSG_PARTY_EXCITED });
 			extendGame(addedMins);
 		}
 	}
@@ -937,8 +2303,14 @@ takes no parameters and has no return value.
 
 void ThiefGame::getInfo()
 {
-	std::string info = m_playerSpace->information();
-	m_backpack.addNote(info);
+	Fact info = m_playerSpace->information();
+	takeNote(info);
+
+	// a guest shows up with a different symbol once met
+	if (info.kind == FACT_MET_GUEST)
+	{
+		markDirty(m_playerSpace);
+	}
 
 	// if the info received is from a clue, remove the clue from
 	// the ground after taking a note
@@ -946,47 +2318,79 @@ void ThiefGame::getInfo()
 	{	
 		Space* emptyFloor = new Floor();
 		replace(m_playerSpace, emptyFloor);
-		m_playerSpace = emptyFloor;
+		setPlayerSpace(emptyFloor);
 	}	
 }
 
 /*****************************************************************
 Deletes about half of the guests from the party, simulating 
 these guests leaving the party. The guests are chosen at random
-but cannot include the thief.
+but cannot include the culprits.
 The method takes no parameters and has no return value.
 *****************************************************************/
 
 void ThiefGame::randGuestsLeave()
 {
-	int numGuestsLeave = m_guestList.size() / 2;
+	std::vector<int> leavingGuests;
+	findLeavingGuests(leavingGuests);
+	int numGuestsLeave = std::min<int>(m_guests.count(GuestTable::LEFT, 
+		0, 0) / 2, leavingGuests.size());
 
-	std::cout << "\n";
-	// the thief is held at index 0, so only choose indices from
-	// 1 and above
+	if (numGuestsLeave > 0)
+	{
+		Message fleeMsg{ MSG_GUESTS_FLEE };
+		fleeMsg.count = numGuestsLeave;
+		say(fleeMsg);
+	}
 	for (int i = 0; i < numGuestsLeave; i++)
 	{
-		int randInd = getRand(1, m_guestList.size() - 1);
-		Person* guest = dynamic_cast<Person*>(m_guestList[randInd]);
-		std::string leaveMsg = "";
-		if (guest->isMet())
-		{
-			leaveMsg += guest->getName();
-		}
-		else
+		int randInd = getRand(0, leavingGuests.size() - 1);
+		removeGuest(leavingGuests[randInd]);
+		leavingGuests[randInd] = leavingGuests.back();
+		leavingGuests.pop_back();
+	} 
+}
+
+/*****************************************************************
+Finds the guests that may leave the party early: every guest 
+still at the party other than the culprits and the guest the 
+player is talking to. The guest ids are placed in the single 
+parameter. No return value.
+*****************************************************************/
+
+void ThiefGame::findLeavingGuests(std::vector<int> &found) const
+{
+	m_guests.select(GuestTable::LEFT, 0, 0, found);
+	found.erase(std::remove_if(found.begin(), found.end(), 
+		[this](int guestId)
 		{
-			leaveMsg += "A guest you did not meet";
-		}
-		leaveMsg += " has left the party.";
-		
-		std::cout << leaveMsg << "\n";
-		m_backpack.addNote(leaveMsg);
+			const Space* guest = m_cells[m_guests.getCell(guestId)];
+			return guest == m_playerSpace || isCulprit(guest);
+		}), found.end());
+}
 
-		Space* emptyFloor = new Floor();
-		replace(m_guestList[randInd], emptyFloor);
-		std::swap(m_guestList[randInd], m_guestList[m_guestList.size() - 1]);
-		m_guestList.pop_back();
-	} 
+/*****************************************************************
+Removes a guest from the party. The guest's space is replaced 
+with an empty floor space and the player is told who left. The 
+single parameter is the guest id. No return value.
+*****************************************************************/
+
+void ThiefGame::removeGuest(int guestId)
+{
+	// guests the player has not met are not named in the notepad
+	Fact leaveNote{ FACT_GUEST_LEFT };
+	if (m_guests.isMet(guestId))
+	{
+		leaveNote.guest = guestId;
+		leaveNote.value = 1;
+	}
+	
+	sayLine(factMessage(leaveNote, m_guests));
+	takeNote(leaveNote);
+
+	Space* emptyFloor = new Floor();
+	replace(m_cells[m_guests.getCell(guestId)], emptyFloor);
+	m_guests.setLeft(guestId);
 }
 
 /*****************************************************************
@@ -994,95 +2398,142 @@ Method tries to add an item to the player's backpack and prints
 a message to the console accordingly. If the item is taken then
 the player's current space is changed to a Floor space (to 
 indicate that the item has been taken). If the player's backpack
-is currently full, then a message is printed to the console
-indicating this. The method takes as a parameter the type of
-item being added and has no return value.
+is currently full or already holds the item, then a message is 
+printed to the console indicating this. The method takes as a 
+parameter the id of the item being added and has no return value.
 *****************************************************************/
 
-void ThiefGame::getItem(std::string itemType)
+void ThiefGame::getItem(ItemId item)
 {
 	// the backpack add method will print the relevant message
 	// to the console
-	bool added = m_backpack.add(itemType);
+	bool added = m_backpack.add(item);
 
 	if (added)
 	{
+		if (m_events != nullptr)
+		{
+			m_events->item(getItemType(item).eventNumber, true);
+		}
+		// a new box is brought out a while later
+		m_timers.schedule(m_minute + ITEM_RESPAWN_DELAY,
+			TimerWheel::ITEM_RESPAWN, item);
 		Space* emptyFloor = new Floor();
 		replace(m_playerSpace, emptyFloor);
-		m_playerSpace = emptyFloor;
+		setPlayerSpace(emptyFloor);
 	}
 }
 
 /*****************************************************************
 Ends the game in a loss. The method indicates to the player
-that the real thief escaped and the identity of the thief. The
-method has no parameters and no return value.
+that the real thief escaped and the identity of the thief (or 
+of every culprit). The method has no parameters and no return 
+value.
 *****************************************************************/
 
 void ThiefGame::gameLoss()
 {
-	Person* thiefPtr = dynamic_cast<Person*>(m_thief);
-	std::cout << "\nThe real thief was " << thiefPtr->getName()
-		<< "! ";
-	if (thiefPtr->isMale())
+	if (m_culprits.size() > 1)
 	{
-		std::cout << "He ";
+		say(Message{ MSG_GROUP_LOSS });
+		for (Space* culprit : m_culprits)
+		{
+			Message culpritMsg{ MSG_CULPRIT_REVEALED };
+			culpritMsg.name = dynamic_cast<Person*>(culprit)->getNameId();
+			sayLine(culpritMsg);
+		}
 	}
-	else 
+	else
 	{
-		std::cout << "She ";
+		Person* thiefPtr = dynamic_cast<Person*>(m_culprits[0]);
+		Message lossMsg{ MSG_GAME_LOSS };
+		lossMsg.name = thiefPtr->getNameId();
+		lossMsg.male = thiefPtr->isMale();
+		say(lossMsg);
 	}
-	std::cout << "escapes as the police are busy talking with\nthe"
-		<< " wrong person!\n";
 	
 	m_gameFinished = true;
+	if (m_events != nullptr)
+	{
+		m_events->gameEnd(false);
+	}
 }
 
 /*****************************************************************
 Ends the game with a win. The method indicates to the player
-that they guessed the thief correctly. The method has no 
-parameters and no return value.
+that they guessed the thief (or every culprit) correctly. The 
+method has no parameters and no return value.
 *****************************************************************/
 
 void ThiefGame::gameWin()
 {
-	Person* thiefPtr = dynamic_cast<Person*>(m_thief);
-	std::cout << "\nThe police interrogate " << thiefPtr->getName()
-		<< " and discover that ";
-
-	if (thiefPtr->isMale())
+	if (m_culprits.size() > 1)
 	{
-		std::cout << "he ";
+		for (Space* culprit : m_culprits)
+		{
+			Person* culpritPtr = dynamic_cast<Person*>(culprit);
+			Message caughtMsg{ MSG_CULPRIT_CAUGHT };
+			caughtMsg.name = culpritPtr->getNameId();
+			caughtMsg.male = culpritPtr->isMale();
+			say(caughtMsg);
+		}
+		say(Message{ MSG_GROUP_WIN });
 	}
 	else
 	{
-		std::cout << "she ";
+		Person* thiefPtr = dynamic_cast<Person*>(m_culprits[0]);
+		Message winMsg{ MSG_GAME_WIN };
+		winMsg.name = thiefPtr->getNameId();
+		winMsg.male = thiefPtr->isMale();
+		say(winMsg);
 	}
 
-	std::cout << "is the thief!\nCongratulations, you correctly "
-		<< "identified the thief and your wallet is returned to you!\n";
-
 	m_gameFinished = true;
+	if (m_events != nullptr)
+	{
+		m_events->gameEnd(true);
+	}
 }
 
 /*****************************************************************
 Extends the end game time by a specified number of minutes. The 
-method takes no parameters and has no return value.
+single parameter is the number of minutes and the method has no
+return value.
 *****************************************************************/
 
 void ThiefGame::extendGame(int addedMins)
 {	
-	for (int i = 0; i < addedMins; i++)
+	m_endMinute += addedMins;
+	m_partyEndTimer = m_timers.reschedule(m_partyEndTimer, m_endMinute);
+	Fact newEnd{ FACT_END_TIME };
+	newEnd.value = m_endMinute;
+	sayLine(factMessage(newEnd, m_guests));
+	takeNote(newEnd);
+}
+
+
+/*****************************************************************
+The player has used an item from the backpack (the backpack has
+already checked the item can be used and printed its text). The
+effect of the item is run by its handler. The single parameter is
+the id of the item and the method has no return value.
+*****************************************************************/
+
+void ThiefGame::useItem(ItemId item)
+{
+	// the handler for each item, in the same order as the ItemId enum
+	static void (ThiefGame::*const itemEffects[NUM_ITEMS])() = {
+		&ThiefGame::useFireworks,
+		&ThiefGame::useTruthCandy
+	};
+
+	if (m_events != nullptr)
 	{
-		addMin(m_endHour, m_endMin, m_endAM);
+		m_events->item(getItemType(item).eventNumber, false);
 	}
-	std::string newEnd = "The new party end time is: ";
-	std::cout << newEnd;	
-	newEnd += printTime(m_endHour, m_endMin, m_endAM);
-	m_backpack.addNote(newEnd);
+	(this->*itemEffects[item])();
 }
 
-
 /*****************************************************************
 The player uses fireworks. The effect on the game state is that
 the game end time is prolonged by 10 minutes. The method takes
@@ -1095,53 +2546,30 @@ void ThiefGame::useFireworks()
 
 	extendGame(addedMin);
 	
-	std::cout << "\nThe fireworks excite the guests and the party will "
-		<< "last longer!\n";	
+	say(Message{ MSG_FIREWORKS_EFFECT });
 }
 
 /*****************************************************************
 The player gives truth candy to a guest. The guest reveals 
-whether or not he/she is the thief. The method takes no parameters
+whether or not he/she is the thief (or one of the culprits). 
+The method takes no parameters
 and has no return value.
 *****************************************************************/
 
 void ThiefGame::useTruthCandy()
 {
 	Person* guestPtr = dynamic_cast<Person*>(m_playerSpace);
-	std::string guestName = guestPtr->getName();
-	// build up string that will be added to the notepad
-	std::string noteStr = guestName + " revealed that ";
-	if (guestPtr->isMale())
-	{
-		noteStr += "he ";
-	}
-	else
-	{
-		noteStr += "she ";
-	}
-
-	std::cout << "\nYou: Here, try out this candy bar, it's "
-		<< "really good!\n"
-		<< guestName << ": Thanks! ... Mmmm this is tasty.. But it is"
-		<< " strange that you're carrying\ncandy around at a party. "
-		<< "And you've got a poor sense of style, a weird\nlooking haircut"
-		<< ", and a..\n"
-		<< "You: OKAY, thanks.. Appreciate the honesty. I have a "
-		<< "question, did you steal my\nwallet tonight?\n"
-		<< guestName << ": ";
-
-	if (m_playerSpace == m_thief)
-	{
-		std::cout << "Yes, I did ";
-		noteStr += "stole your wallet.";
-	}
-	else
-	{
-		std::cout << "No, I did not ";
-		noteStr += "did not steal your wallet.";
-	}
-	std::cout << "steal your wallet!\n";
-	m_backpack.addNote(noteStr);	
+	Message answer{ MSG_TRUTH_OFFER };
+	answer.name = guestPtr->getNameId();
+	answer.male = guestPtr->isMale();
+	say(answer);
+
+	Fact note{ FACT_TRUTH };
+	note.guest = guestPtr->getId();
+	note.value = isCulprit(m_playerSpace);
+	answer.id = note.value ? MSG_TRUTH_ADMIT : MSG_TRUTH_DENY;
+	say(answer);
+	takeNote(note);
 }
 
 /*****************************************************************
@@ -1167,9 +2595,9 @@ void ThiefGame::useLauncher(int direction)
 	static constexpr int DOWN{ 4 };
 	static constexpr int LEFT{ 5 };
 
-	static const std::string crashMsg{ "\nYou fly across the room "
-		"and slam into the wall!\n" };
-	static const std::string mapMsg{ "\nAn updated map of the room:\n" };
+	// the player is told which way they flew
+	Message crashMsg{ MSG_LAUNCH_CRASH };
+	crashMsg.direction = direction - UP;
 
 	// pointer that is used for determining new player location
 	Space* nextSpace = m_playerSpace;
@@ -1183,52 +2611,52 @@ void ThiefGame::useLauncher(int direction)
 	{
 		case UP:
 		{
-			nextSpace = nextSpace->getUp();
-			while (nextSpace != nullptr)
-			{	
-				m_playerSpace = nextSpace;
+			while (nextSpace->getUp() != nullptr)
+			{
 				nextSpace = nextSpace->getUp();
-			} 
-			std::cout << crashMsg << mapMsg;
+			}
+			setPlayerSpace(nextSpace);
+			say(crashMsg);
+			say(Message{ MSG_LAUNCH_MAP });
 			printRoom();
 			break;
 		}
 
 		case RIGHT:
 		{
-			nextSpace = nextSpace->getRight();
-			while (nextSpace != nullptr)
+			while (nextSpace->getRight() != nullptr)
 			{
-				m_playerSpace = nextSpace;
 				nextSpace = nextSpace->getRight();
 			}
-			std::cout << crashMsg << mapMsg;
+			setPlayerSpace(nextSpace);
+			say(crashMsg);
+			say(Message{ MSG_LAUNCH_MAP });
 			printRoom();	
 			break;
 		}
 
 		case DOWN:
 		{
-			nextSpace = nextSpace->getDown();
-			while (nextSpace != nullptr)
+			while (nextSpace->getDown() != nullptr)
 			{
-				m_playerSpace = nextSpace;
 				nextSpace = nextSpace->getDown();
 			}
-			std::cout << crashMsg << mapMsg;
+			setPlayerSpace(nextSpace);
+			say(crashMsg);
+			say(Message{ MSG_LAUNCH_MAP });
 			printRoom();				
 			break;
 		}
 
 		case LEFT:
 		{
-			nextSpace = nextSpace->getLeft();
-			while (nextSpace != nullptr)
+			while (nextSpace->getLeft() != nullptr)
 			{
-				m_playerSpace = nextSpace;
 				nextSpace = nextSpace->getLeft();
 			}
-			std::cout << crashMsg << mapMsg;
+			setPlayerSpace(nextSpace);
+			say(crashMsg);
+			say(Message{ MSG_LAUNCH_MAP });
 			printRoom();	
 			break;
 		}
@@ -22,14 +22,32 @@
 **				police and guessing the identity of the thief 
 **				correctly. But once the player calls the police, they
 **				only get a single guess.
+**				A game may also have two or three culprits (see
+**				GameOptions), in which case the clues describe the
+**				group and the player must name every culprit.
 *********************************************************************/
 
 #ifndef THIEFGAME_HPP
 #define THIEFGAME_HPP
 
 #include <vector>
+#include <bitset>
+#include <chrono>
 #include "Backpack.hpp"
 #include "Space.hpp"
+#include "GameOptions.hpp"
+#include "EventStream.hpp"
+#include "Messages.hpp"
+#include "TimerWheel.hpp"
+#include "Fact.hpp"
+#include "Item.hpp"
+#include "GuestIndex.hpp"
+#include "GuestTable.hpp"
+#include "Crowd.hpp"
+#include "DistanceField.hpp"
+#include "Snapshot.hpp"
+#include "RoomLayout.hpp"
+#include "GameJournal.hpp"
 
 class ThiefGame {
 	private:
@@ -38,20 +56,87 @@ class ThiefGame {
 		static constexpr int NUM_ROWS = 8;
 		static constexpr int NUM_COLS = 12;
 		static constexpr int NUM_GUESTS = 10;
+		static constexpr int NUM_CELLS = NUM_ROWS * NUM_COLS;
+
+		// number of directions the player can move in and the
+		// number of possible combinations of open directions
+		static constexpr int NUM_DIRS = 4;
+		static constexpr int NUM_MOVE_MENUS = 1 << NUM_DIRS;
+
+		// the party starts at 11:00PM and lasts 30 minutes
+		// (times are held as minutes since midnight on the
+		// day the party starts)
+		static constexpr int MINS_PER_DAY = 24 * 60;
+		static constexpr int START_MINUTE = 23 * 60;
+		static constexpr int PARTY_LENGTH = 30;
+
+		// minutes after the start of the party at which a guest
+		// leaves early
+		static constexpr int GUEST_LEAVE_TIMES[] = { 10, 20 };
+		// minutes before a picked up item box is brought back
+		static constexpr int ITEM_RESPAWN_DELAY = 8;
+		// minutes the police take to arrive in the real-time game
+		static constexpr int POLICE_DELAY = 3;
+
+		// when guests wander, the culprits start to keep away
+		// from the player once the player is this many steps away (or
+		// closer). Distances from the player are kept out to the
+		// horizon.
+		static constexpr int THIEF_ALERT_DISTANCE = 4;
+		static constexpr int FIELD_HORIZON = 2 * THIEF_ALERT_DISTANCE;
+		// how many steps of distance a culprit gives up to keep
+		// away from each clue next to it
+		static constexpr int CLUE_AVOIDANCE = 2;
+
+		// the bytes a game snapshot starts with and the version
+		// of the snapshot format (see Snapshot.hpp)
+		static constexpr char SNAPSHOT_MAGIC[] = "FTTS";
+		static constexpr int MAGIC_LENGTH = 4;
+		static constexpr unsigned int SNAPSHOT_VERSION = 1;
+		// minutes between the snapshots written to the journal in
+		// the turn based game (the real-time game writes one every
+		// minute)
+		static constexpr int CHECKPOINT_MINUTES = 5;
+
+		// how the constructor sets up the room: a new party, an
+		// empty room to be filled in from a snapshot, or no room
+		// at all (for a room built from a prebuilt layout)
+		enum RoomSetup { NEW_PARTY, EMPTY_ROOM, NO_ROOM };
 
 		// holds pointers to the starting spaces for each
 		// row in the room
 		Space* m_rowStart[NUM_ROWS];
 
-		// holds pointers to the spaces representing each of
-		// the guests in the game
-		std::vector<Space*> m_guestList;
-
-		// pointer to the thief Space
-		Space* m_thief;
-		// holds the row/column of the thief
-		int m_thiefRow;
-		int m_thiefCol;
+		// holds a pointer to the Space in each cell of the
+		// room (indexed by row * NUM_COLS + col)
+		Space* m_cells[NUM_CELLS];
+
+		// the id of the guest in each cell of the room, and the
+		// guests in each region of the room. Updated whenever a
+		// guest is placed or removed (see replace).
+		GuestIndex m_guestIndex;
+
+		// moves the guests around the room when guests are set
+		// to wander, and the guests that moved in the last minute
+		Crowd m_crowd;
+		std::vector<Crowd::Move> m_crowdMoves;
+
+		// the distance of each cell from the player, used by the
+		// culprits to keep away from the player when guests wander.
+		// The player can step onto every space, so no cells are
+		// blocked.
+		DistanceField m_playerField;
+
+		// every guest created for the party (indexed by guest
+		// id), held as arrays of the guests' names, flags and
+		// cells. The Person spaces in the room read from it.
+		// Guests stay in the table after they leave so notes 
+		// about them can be read.
+		GuestTable m_guests;
+
+		// pointers to the Spaces of the culprits (the thief and
+		// any accomplices)
+		std::vector<Space*> m_culprits;
 
 		// contains true once the game is finished and false
 		// otherwise
@@ -64,22 +149,105 @@ class ThiefGame {
 		// the player's backpack
 		Backpack m_backpack;
 
-		// variables that are used to represent the current 
-		// game time
-		std::string m_hour;
-		std::string m_min;
-		bool m_isAM;
-
-		// variables that are used to represent the end
-		// game time
-		std::string m_endHour;
-		std::string m_endMin;
-		bool m_endAM;
+		// holds the cells (as row * NUM_COLS + col) that have
+		// changed since the room was last drawn, in the order
+		// they changed. The bitset holds true for every cell
+		// already in the list so a cell is only listed once.
+		std::vector<int> m_dirtyCells;
+		std::bitset<NUM_CELLS> m_dirtyMask;
+
+		// the current game time and the end game time. These
+		// keep counting past midnight and are only turned into
+		// clock times when they are displayed.
+		int m_minute;
+		int m_endMinute;
+
+		// the settings the game was started with
+		GameOptions m_options;
+
+		// stream that game events are written to for viewers.
+		// Set to nullptr if there are no viewers.
+		EventStream* m_events;
+
+		// the events scheduled for later in the game, the 
+		// timers fired in the current minute and handles to
+		// the party end and police arrival timers
+		TimerWheel m_timers;
+		std::vector<TimerWheel::Timer> m_firedTimers;
+		int m_partyEndTimer;
+		int m_policeTimer;
+
+		// holds true if the guest named to the police is the
+		// thief (only used while the police are on their way)
+		bool m_correctGuess;
+
+		// the wall clock time at which the next minute passes
+		// in the real-time game
+		std::chrono::steady_clock::time_point m_nextTick;
+
+		// the state of the game's random number generator (an
+		// xorshift generator, so a saved game carries on with
+		// the same random numbers)
+		unsigned int m_randState;
+
+		// the file the player can save the game to (nullptr if
+		// saving is off), and true once the game has been
+		// restored from a snapshot or saved, so that running it
+		// carries on where it left off
+		const char* m_saveFile;
+		bool m_resumed;
+
+		// the journal the game is written to as it is played
+		// (nullptr if none), and the minute of the last snapshot
+		// written to it
+		GameJournal* m_journal;
+		int m_checkpointMinute;
 
 		// meant to hold true once the random seed for the 
 		// program has been set and false beforehand
 		static bool seedSet;
 
+		// constructor, sets up a game with the given settings
+		// (first parameter). The second parameter says whether
+		// to set up a new party or leave the room empty.
+		ThiefGame(const GameOptions &options, RoomSetup setup);
+
+		// Tells the backpack and the crowd which guests are the
+		// culprits. No parameters and no return value.
+		void pinCulprits();
+
+		// Drops the changes made while setting up the room and
+		// schedules the events of the party. No parameters and no
+		// return value.
+		void startParty();
+
+		// Builds the room from the prebuilt layout passed as the
+		// parameter, without starting from an empty room. No 
+		// return value.
+		void setLayoutRoom(const RoomLayout &layout);
+
+		// Returns the tile for the kind of the given Space.
+		static RoomLayout::Tile tileOf(const Space* spc);
+
+		// Restores the state of the game from a snapshot into a
+		// game with an empty room. Returns false if the snapshot
+		// is not valid.
+		bool restore(SnapshotReader &in);
+
+		// Writes the turn to the journal, starting it again from
+		// a snapshot if the parameter is true or one is due. No
+		// return value.
+		void checkpoint(bool force);
+
+		// Saves the game to the save file and tells the player.
+		// Returns true if the game was saved.
+		bool saveGame();
+
+		// Presents the player with the information about the 
+		// game at the start of a new game. No parameters and no
+		// return value.
+		void introduce();
+
 		// provides the intial setup for the room. Sets up
 		// a room solely composed of Floor spaces. The
 		// method takes no parameters and has no return
@@ -104,23 +272,74 @@ class ThiefGame {
 
 		// Returns a random integer between the two
 		// parmeters (inclusive).
-		int getRand(int min, int max) const;
+		int getRand(int min, int max);
 
 		// Places a given Space at a random location in the 
 		// room. However, the random location must currently
-		// be a Floor space. The first parameter is the space
-		// that is being placed. The second parameter holds true
-		// if the space is the thief (in which case the exact 
-		// location of the thief will be saved) and false
-		// otherwise. The method has no return value.
-		void place(Space* newSpace, bool isThief);
+		// be a Floor space. The single parameter is the space
+		// that is being placed. The method has no return value.
+		void place(Space* newSpace);
 
 		// Replaces a Space in the room matrix with another
 		// Space. The first parameter is the old Space and 
-		// the second parameter is the new Space. The method
-		// has no return value.
+		// the second parameter is the new Space. The old Space
+		// is freed. The method has no return value.
 		void replace(Space* oldSpace, Space* newSpace);
 
+		// Records a Space just put in the room with the guest
+		// table, the guest index and the crowd. No return value.
+		void track(Space* newSpace);
+
+		// Puts the new Space (second parameter) in the place of
+		// the old Space (first parameter) without freeing the
+		// old Space. Used to move guests. No return value.
+		void link(Space* oldSpace, Space* newSpace);
+
+		// Moves the guests on by a minute when guests are set to
+		// wander. No parameters and no return value.
+		void moveGuests();
+
+		// Moves a guest (first parameter) onto the floor space
+		// given as the second parameter, leaving floor behind.
+		// The floor space is freed. No return value.
+		void moveGuest(Space* guest, Space* dest);
+
+		// Moves a culprit (the single parameter) a step away 
+		// from the player (and away from the clues) if the 
+		// player is close. Only used when guests wander. No 
+		// return value.
+		void moveCulprit(Space* culprit);
+
+		// Returns the number of clues next to the given Space.
+		int cluesNextTo(const Space* spc) const;
+
+		// Adds a note to the player's notepad and sends it to
+		// the event stream. Empty notes are ignored. The method
+		// has no return value.
+		void takeNote(Fact note);
+
+		// Sends every changed cell (along with the player
+		// location and the time) to the event stream and then
+		// empties the list of changed cells. Called whenever
+		// the room has been drawn. No parameters and no return
+		// value.
+		void endFrame();
+
+		// Sends the whole room, the player location and the 
+		// time to the event stream. Used at the start of a 
+		// game. No parameters and no return value.
+		void publishRoom();
+
+		// Records that the cell holding the given Space has
+		// changed since the room was last drawn. The method
+		// has no return value.
+		void markDirty(const Space* spc);
+
+		// Moves the player to the given Space, marking both
+		// the old and new player cells as changed. The method
+		// has no return value.
+		void setPlayerSpace(Space* newSpace);
+
 		// Creates the clues for the game and places them
 		// in random locations in the room. The method takes
 		// no parameters and has no return value.
@@ -152,60 +371,83 @@ class ThiefGame {
 		void placePlayer();
 
 		// Finds and returns a random Floor space in the
-		// room (returned as a pointer to the Space). The
-		// single parameter holds true if the space will
-		// hold the thief (in which case the location of the
-		// the space is saved) and false otherwise. 
-		Space* getRandFloor(bool isThief);
+		// room other than the player's (returned as a pointer
+		// to the Space). No parameters.
+		Space* getRandFloor();
+
+		// Returns true if the given Space is one of the culprits.
+		bool isCulprit(const Space* spc) const;
 
 		// Prints the current game time to the console. The
 		// method takes no parameters and has no return value.
 		void printTime() const;
 
-		// Prints the a given time to the console. 
-		// The first parameter represents the current hour as 
-		// a string, the second parameter the current minute 
-		// as a string and the third parameter holds true if 
-		// the time is AM and false otherwise. The method returns
-		// as a string the same information that is printed.
-		std::string printTime(std::string hour, std::string min, 
-			bool isAM) const;
-
 		// Adds a minute to the current game time. Takes
 		// no paramters and has no return value.
 		void addMin();
 
-		// Adds a minute to a given time. The method has
-		// no return value and takes in three reference
-		// parameters. The first parameter represents the
-		// current hour as a string, the second parameter
-		// represents the current minute as a string, and
-		// the third parameter holds true if the time is AM
-		// and false otherwise.
-		void addMin(std::string &hour, std::string &min,
-			bool &isAM);
+		// Runs every event scheduled for the current minute. 
+		// The method takes no parameters and has no return value.
+		void runTimers();
+
+		// The party has reached its end time, so the player is
+		// made to call the police (unless they are already on
+		// their way). No parameters and no return value.
+		void partyEnd();
+
+		// The player has named a guest to the police. The single
+		// parameter holds true if the guest is the thief. No 
+		// return value.
+		void policeCalled(bool correctGuess);
+
+		// The police arrive and the game ends. The single 
+		// parameter holds true if the guest named is the thief.
+		// No return value.
+		void policeArrive(bool correctGuess);
+
+		// A culprit (given as its place in the list of culprits)
+		// tries to slip out before the police arrive and escapes
+		// unless the player is watching. No return value.
+		void thiefSlipsOut(int culpritInd);
+
+		// A single random guest (never a culprit) leaves the
+		// party. No parameters and no return value.
+		void guestLeaves();
+
+		// Brings back a box of the given item (an ItemId) to a
+		// random floor space. No return value.
+		void respawnItem(int item);
+
+		// Moves the clock on by a minute in the real-time game
+		// and prints the new time. The method takes no 
+		// parameters and has no return value.
+		void clockTick();
+
+		// Prompts the player with the given menu and returns
+		// the option chosen. In the real-time game the clock
+		// keeps running while the player decides, and 0 is 
+		// returned if the game ends before a choice is made.
+		int chooseTimed(const Menu &menu);
 
 		// Sets up the player's move menu for a single 
-		// turn. The menu is built based on where the player
+		// turn. The menu is chosen based on where the player
 		// can move to from the current player location. 
-		// The method takes two reference parameters. The 
-		// first represents the menu that will be built and
-		// the second is a vector of space pointers that will
-		// hold the possible move choices for the player. The
-		// method has no return value.
-		void setMoveMenu(Menu &moveMenu,
-			std::vector<Space*> &moveChoices) const;
+		// The single parameter is an array that will be filled
+		// with the possible move choices for the player (in
+		// the same order as the menu options). The method 
+		// returns a reference to the menu.
+		const Menu& setMoveMenu(Space* moveChoices[NUM_DIRS]) const;
 
 		// Prompts the player with a menu to move and 
 		// performs the movement based on the player's 
 		// choice. The method's first parameter is the
 		// menu with which the player will be prompted
-		// and the second parameter is a vector of Space
+		// and the second parameter is an array of Space
 		// pointers representing each of the choices 
 		// (need to be in the same order as presented in 
 		// the menu). The method has no return value. 
 		void movePlayer(const Menu &moveMenu,
-			const std::vector<Space*> &moveChoices);
+			Space* const moveChoices[NUM_DIRS]);
 
 		// Prints the current state of the room as a grid.
 		// The method prints a '*' at the location of the
@@ -234,44 +476,60 @@ class ThiefGame {
 		// Deletes about half of the guests from the party,
 		// simulating these guests leaving the party. The
 		// guests are chosen at random but cannot include
-		// the thief. The method takes no parameters and has
+		// the culprits. The method takes no parameters and has
 		// no return value.
 		void randGuestsLeave();
 
+		// Finds the guests that may leave the party early: the
+		// guests still at the party other than the culprits and
+		// the guest the player is talking to. The guest ids are
+		// placed in the single parameter. No return value.
+		void findLeavingGuests(std::vector<int> &found) const;
+
+		// Removes the guest with the given guest id from the 
+		// party and tells the player. No return value.
+		void removeGuest(int guestId);
+
 		// The method tries to add a given item to the player's
 		// backpack and prints a message accordingly. If the
 		// item is successfully added, then the Space is changed
 		// to a Floor space. If the player's backpack is currently
 		// full then a message is printed to the console indicating
 		// this (and the current Space is not changed). The method
-		// takes as a parameter the type of item being added 
-		// (as a string) and has no return value.
-		void getItem(std::string itemType);
+		// takes as a parameter the id of the item being added 
+		// and has no return value.
+		void getItem(ItemId item);
 
 		// Ends the game in a loss. The method indicates to the 
 		// player that the real thief has escaped and the 
-		// identity of the thief. The method has no parameters
-		// and no return value.
+		// identity of the thief (or of every culprit). The 
+		// method has no parameters and no return value.
 		void gameLoss();
 
 		// Ends the game with a win. The method indicates to the
 		// player that they guessed the identity of the thief 
-		// correctly. The method has no parameters and no 
-		// return value.
+		// (or of every culprit) correctly. The method has no
+		// parameters and no return value.
 		void gameWin();
 
 		// Adds a specified number of minutes to the end game time.
-		// The method takes no parameters and has no return value.
+		// The method has no return value.
 		void extendGame(int addedMins);
 
+		// Runs the effect of an item the player has used from the
+		// backpack. The single parameter is the id of the item and
+		// the method has no return value.
+		void useItem(ItemId item);
+
 		// The player uses fireworks. The effect is that the 
 		// game end time is delayed. The method takes no parameters
 		// and has no return value. 
 		void useFireworks();
 
 		// The player gives truth candy to a guest. The guest reveals
-		// whether or not he/she is the thief. The method takes no 
-		// parameters and has no return value.
+		// whether or not he/she is the thief (or one of the 
+		// culprits). The method takes no parameters and has no 
+		// return value.
 		void useTruthCandy();
 
 		// Allows the player to use the launcher. Launches the player
@@ -284,9 +542,13 @@ class ThiefGame {
  
 	public:
 		// default constructor, sets up the initial state for
-		// the game
+		// the turn based game
 		ThiefGame();
 
+		// constructor, sets up the initial state for a game
+		// with the given settings
+		ThiefGame(const GameOptions &options);
+
 		// Runs a full Find the Thief game. If the game for this
 		// instance has already been completed, the method does
 		// nothing and returns false. Otherwise, the method
@@ -294,6 +556,58 @@ class ThiefGame {
 		// takes no parameters.
 		bool runGame();
 
+		// Returns the cells (as row * NUM_COLS + col) that have
+		// changed since the room was last drawn, including
+		// replaced tiles, newly met guests and player moves.
+		const std::vector<int>& getDirtyCells() const;
+
+		// Empties the list of changed cells. The method takes
+		// no parameters and has no return value.
+		void clearDirty();
+
+		// Sets the stream that the events of the game are
+		// written to. The stream is not owned by the game and
+		// nullptr turns the events off. No return value.
+		void setEventStream(EventStream* events);
+
+		// Sets the file the player can save the game to from
+		// the main menu (nullptr turns saving off). The path is
+		// not copied. No return value.
+		void setSaveFile(const char* path);
+
+		// Sets the journal the game is written to as it is
+		// played. The journal is not owned by the game and 
+		// nullptr turns journaling off. No return value.
+		void setJournal(GameJournal* journal);
+
+		// Returns true once the game is finished.
+		bool isFinished() const;
+
+		// Adds a snapshot of the complete state of the game to
+		// the vector passed as the parameter (see Snapshot.hpp
+		// for the format). No return value.
+		void save(std::vector<unsigned char> &snapshot) const;
+
+		// Creates a game from a snapshot made by save. The
+		// parameters are the snapshot and its length in bytes.
+		// Returns the new game (owned by the caller), or nullptr
+		// if the snapshot is not valid.
+		static ThiefGame* load(const unsigned char* data, 
+			std::size_t size);
+
+		// Creates a game in the prebuilt room whose layout is
+		// the second parameter, with the settings given as the
+		// first parameter (the culprits come from the layout).
+		// Returns the new game (owned by the caller), or nullptr
+		// if the layout is not the size of the room.
+		static ThiefGame* fromLayout(const GameOptions &options,
+			const RoomLayout &layout);
+
+		// Writes the room as it is now to a prebuilt layout file
+		// whose path is the parameter. Returns true if the file
+		// was written.
+		bool writeLayout(const char* path) const;
+
 		// Destructor. Frees the memory associated with each
 		// of the dynamically allocated Spaces in the room matrix.
 		~ThiefGame();
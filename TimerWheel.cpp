@@ -0,0 +1,158 @@
+/*********************************************************************
+** Program name: TimerWheel.cpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Implementation file for the TimerWheel class.
+**				Used with the ThiefGame class to schedule events for
+**				a given game minute. See TimerWheel.hpp for how the
+**				timers are held.
+*********************************************************************/
+
+#include "TimerWheel.hpp"
+#include <vector>
+#include <algorithm>
+
+/****************************************************************
+Schedules an event. The first parameter is the minute the event
+is due, the second parameter is the event and the third parameter
+is a value that depends on the event. Returns a handle to the
+timer, which is only valid until the timer fires or is cancelled.
+****************************************************************/
+
+int TimerWheel::schedule(int minute, TimerEvent event, int arg)
+{
+	int handle;
+	if (m_freeHandles.empty())
+	{
+		handle = m_timers.size();
+		m_timers.push_back(Entry{ });
+	}
+	else
+	{
+		handle = m_freeHandles.back();
+		m_freeHandles.pop_back();
+	}
+
+	m_timers[handle] = Entry{ Timer{ minute, event, arg }, true };
+	m_slots[minute & SLOT_MASK].push_back(handle);
+	return handle;
+}
+
+/****************************************************************
+Cancels the timer with the handle passed as the parameter. The
+timer is left in its slot and is dropped (and its handle freed)
+when the wheel next passes the slot. Does nothing if the handle 
+is not a scheduled timer. No return value.
+****************************************************************/
+
+void TimerWheel::cancel(int handle)
+{
+	if (isScheduled(handle))
+	{
+		m_timers[handle].active = false;
+	}
+}
+
+/****************************************************************
+Moves a timer to a new minute. The first parameter is the handle
+of the timer and the second parameter is the new minute. Returns
+the new handle for the timer, or NO_TIMER (and nothing is 
+scheduled) if the handle is not a scheduled timer.
+****************************************************************/
+
+int TimerWheel::reschedule(int handle, int minute)
+{
+	if (!isScheduled(handle))
+	{
+		return NO_TIMER;
+	}
+
+	Timer timer = m_timers[handle].timer;
+	cancel(handle);
+	return schedule(minute, timer.event, timer.arg);
+}
+
+/****************************************************************
+Fires every timer due at the minute passed as the first parameter.
+Only the slot for the minute is looked at. The fired timers are
+placed in the second parameter in the order they were scheduled,
+timers due on a later lap of the wheel are kept, and cancelled
+timers are dropped. No return value.
+****************************************************************/
+
+void TimerWheel::advance(int minute, std::vector<Timer> &fired)
+{
+	fired.clear();
+
+	std::vector<int> &slot = m_slots[minute & SLOT_MASK];
+	std::size_t kept = 0;
+	for (std::size_t i = 0; i < slot.size(); i++)
+	{
+		int handle = slot[i];
+		const Entry &entry = m_timers[handle];
+		if (entry.active && entry.timer.minute != minute)
+		{
+			slot[kept++] = handle;
+			continue;
+		}
+
+		if (entry.active)
+		{
+			fired.push_back(entry.timer);
+		}
+		m_timers[handle].active = false;
+		m_freeHandles.push_back(handle);
+	}
+	slot.resize(kept);
+}
+
+/****************************************************************
+Places the handles of every scheduled timer in the parameter (which
+is cleared first), in the order they will fire: by minute, and in
+the order they were scheduled within a minute. No return value.
+****************************************************************/
+
+void TimerWheel::pending(std::vector<int> &handles) const
+{
+	handles.clear();
+	for (int slot = 0; slot < NUM_SLOTS; slot++)
+	{
+		for (int handle : m_slots[slot])
+		{
+			if (m_timers[handle].active)
+			{
+				handles.push_back(handle);
+			}
+		}
+	}
+
+	// a slot holds its timers in the order they were scheduled, so
+	// a stable sort keeps that order within a minute
+	std::stable_sort(handles.begin(), handles.end(),
+		[this](int first, int second)
+		{
+			return m_timers[first].timer.minute 
+				< m_timers[second].timer.minute;
+		});
+}
+
+/****************************************************************
+Returns the timer with the handle passed as the parameter.
+****************************************************************/
+
+const TimerWheel::Timer& TimerWheel::getTimer(int handle) const
+{
+	return m_timers[handle].timer;
+}
+
+/****************************************************************
+Returns true if the handle passed as the parameter is in range
+and its timer has not fired or been cancelled. Returns false for
+NO_TIMER.
+****************************************************************/
+
+bool TimerWheel::isScheduled(int handle) const
+{
+	return handle >= 0 && handle < static_cast<int>(m_timers.size())
+		&& m_timers[handle].active;
+}
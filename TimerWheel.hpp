@@ -0,0 +1,102 @@
+/*********************************************************************
+** Program name: TimerWheel.hpp
+** Author:		agent
+** Date:		October 19, 2026
+** Description:	Header file for the TimerWheel class.
+**				Used with the ThiefGame class to schedule events for
+**				a given game minute (ex. the end of the party or a
+**				guest leaving). The timers are kept in a hashed
+**				timer wheel: a ring of slots indexed by the minute
+**				modulo the number of slots. Scheduling and cancelling
+**				a timer only touch a single slot, and moving the
+**				clock on by a minute only looks at the timers in the
+**				slot for that minute. Timers more than a lap of the
+**				wheel away simply stay in their slot until their
+**				minute comes round.
+*********************************************************************/
+
+#ifndef TIMERWHEEL_HPP
+#define TIMERWHEEL_HPP
+
+#include <vector>
+
+class TimerWheel {
+	public:
+		// the events that can be scheduled
+		enum TimerEvent {
+			PARTY_END = 1,
+			GUEST_LEAVES,
+			ITEM_RESPAWN,
+			POLICE_ARRIVE,
+			THIEF_SLIPS_OUT
+		};
+
+		// a scheduled event: the minute it is due, the event
+		// and a value that depends on the event (ex. the item of
+		// ITEM_RESPAWN or the culprit of THIEF_SLIPS_OUT)
+		struct Timer {
+			int minute;
+			TimerEvent event;
+			int arg;
+		};
+
+		// returned in place of a timer handle when there is
+		// no timer
+		static constexpr int NO_TIMER = -1;
+
+		// Schedules an event for the given minute and returns
+		// a handle to the timer. The handle is only valid until
+		// the timer fires or is cancelled.
+		int schedule(int minute, TimerEvent event, int arg);
+
+		// Cancels the timer with the given handle. Does nothing
+		// if the handle is not a scheduled timer (ex. NO_TIMER).
+		// No return value.
+		void cancel(int handle);
+
+		// Moves the timer with the given handle to a new minute
+		// and returns the new handle for the timer. Returns
+		// NO_TIMER if the handle is not a scheduled timer.
+		int reschedule(int handle, int minute);
+
+		// Fires every timer due at the given minute. The fired
+		// timers are placed in the second parameter (in the
+		// order they were scheduled) and are removed from the
+		// wheel. Must be called for every minute in turn. No
+		// return value.
+		void advance(int minute, std::vector<Timer> &fired);
+
+		// Places the handles of every scheduled timer in the
+		// parameter, in the order they will fire. Used to save
+		// the timers. No return value.
+		void pending(std::vector<int> &handles) const;
+
+		// Returns the timer with the given handle.
+		const Timer& getTimer(int handle) const;
+
+	private:
+		// Returns true if the handle is the handle of a timer
+		// that is still scheduled.
+		bool isScheduled(int handle) const;
+
+		// number of slots in the wheel (a power of two so the
+		// slot for a minute is found with a mask)
+		static constexpr int NUM_SLOTS = 64;
+		static constexpr int SLOT_MASK = NUM_SLOTS - 1;
+
+		// a timer along with whether it is still scheduled
+		struct Entry {
+			Timer timer;
+			bool active;
+		};
+
+		// every timer, indexed by handle. Handles of timers that
+		// have fired or been cancelled are reused.
+		std::vector<Entry> m_timers;
+		std::vector<int> m_freeHandles;
+
+		// the handles of the timers in each slot of the wheel
+		std::vector<int> m_slots[NUM_SLOTS];
+};
+
+#endif
@@ -11,15 +11,12 @@
 *********************************************************************/
 
 #include "TruthCandyBox.hpp"
-#include <iostream>
+#include "Messages.hpp"
 #include <string>
 
 // intitialize the TYPE static constant which represents the
 // type of this Space
 const std::string TruthCandyBox::TYPE{ "TruthCandyBox" };
-// initialize the ITEM static constant which represents the
-// type of item held in this Space
-const std::string TruthCandyBox::ITEM{ "Truth Candy Bar" };
 
 /****************************************************************
 Default constructor. 
@@ -51,24 +48,23 @@ std::string TruthCandyBox::statType()
 }
 
 /****************************************************************
-Returns the ITEM string. No parameters. Static method so can be 
-used without an object instance.
+Returns the id of the item held in the box. No parameters. 
+Static method so can be used without an object instance.
 ****************************************************************/
 
-std::string TruthCandyBox::statItem()
+ItemId TruthCandyBox::statItem()
 {
-	return ITEM;
+	return TRUTH_CANDY_ITEM_ID;
 }
 
 /****************************************************************
-Prints a single character to the console representing the
-TruthCandyBox space. The method takes no parameters and has no return 
-value.
+Returns the single character that represents the TruthCandyBox
+space on the map. The method takes no parameters.
 ****************************************************************/
 
-void TruthCandyBox::printSpace() const
+char TruthCandyBox::getSymbol() const
 {
-	std::cout << "T"; 
+	return 'T';
 }
 
 /****************************************************************
@@ -79,21 +75,17 @@ holding the TYPE value.
 
 std::string TruthCandyBox::event()
 {
-	std::cout << "\nYou open up a box on the ground and pull out"
-		<< " a Truth Candy Bar.\nYou read the label on the back:\n"
-		<< "WARNING: This candy bar will cause the consumer to be "
-		<< "completely honest for up\nto an hour. Politicians "
-		<< "should only consume in private settings.\n";
+	say(Message{ MSG_TRUTH_CANDY_FOUND });
 	return TYPE;
 }
 
 /****************************************************************
-Returns information related to the TruthCandyBox as a string. 
+Returns information related to the TruthCandyBox as a Fact. 
 Given that TruthCandyBox spaces do not contain any information, 
-the method returns an empty string.
+the method returns an empty Fact.
 ****************************************************************/
 
-std::string TruthCandyBox::information() 
+Fact TruthCandyBox::information() 
 {
-	return "";	
+	return Fact();	
 }
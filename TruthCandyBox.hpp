@@ -14,12 +14,13 @@
 #define TRUTHCANDYBOX_HPP 
 
 #include "Space.hpp"
+#include "Fact.hpp"
+#include "Item.hpp"
 #include <string>
 
 class TruthCandyBox : public Space {
 	private:	
 		static const std::string TYPE;
-		static const std::string ITEM;
 	public:
 		// Default constructor
 		TruthCandyBox();
@@ -35,14 +36,13 @@ class TruthCandyBox : public Space {
 		// object instance.
 		static std::string statType();
 
-		// Returns the ITEM string value which
-		// represents the type of item held in this
+		// Returns the id of the item held in this 
 		// Space.
-		static std::string statItem();
+		static ItemId statItem();
 
-		// Prints a single character to the console
-		// representing the TruthCandyBox space.
-		virtual void printSpace() const override;
+		// Returns the single character that represents
+		// the TruthCandyBox space on the map.
+		virtual char getSymbol() const override;
 
 		// Performs an event related to the TruthCandyBox
 		// and returns a string representing the
@@ -50,8 +50,8 @@ class TruthCandyBox : public Space {
 		virtual std::string event() override;
 
 		// Returns information related to the TruthCandyBox
-		// as a string. No parameters.
-		virtual std::string information() override;	
+		// as a Fact. No parameters.
+		virtual Fact information() override;	
 };
 
 #endif
@@ -20,18 +20,279 @@
 **		the parameters were entered in the wrong order and 
 **		the min parameter is treated as the max (and vice
 **		versa). 
+**		* Updated - input lines are read into a reused buffer
+**		and parsed with std::from_chars rather than being
+**		copied into temporary strings. The program exits if
+**		the input ends before a valid integer is entered.
+**		* Updated - a line starting with a letter is read as
+**		a command line. It is split into commands (separated
+**		by spaces, tabs, commas or semicolons) that are queued
+**		and handed out one per prompt, so several prompts can
+**		be answered with one line (ex. "m r" or "b 2 3"). Menu
+**		options can be chosen by their one letter command
+**		through the choiceValid function.
+**		* Updated - input is read straight from the standard
+**		input file descriptor so that waitForInput can wait for
+**		a line with a timeout (used by the real-time game).
+**		* Updated - the textValid function reads a single entry
+**		as text (ex. the start of a guest's name).
+**		* Updated - every line read can be passed to a recorder
+**		(used to journal the player's input), and lines can be
+**		replayed as input before standard input is read. The
+**		output printed while replaying is held back, and only
+**		the output since the last replayed line is shown once
+**		the replayed lines run out.
 *********************************************************************/
 
 #include "intValid.hpp"
 #include <iostream>
 #include <string>
-#include <cctype>
+#include <string_view>
+#include <sstream>
+#include <functional>
+#include <charconv>
+#include <system_error>
 #include <cstdlib>
-#include <climits>
+#include <cctype>
+#include <cstring>
+#include <cerrno>
+#include <utility>
+#include <algorithm>
+#include <chrono>
+#include <poll.h>
+#include <unistd.h>
+
+// holds the current line of input. The same string is used for every
+// line so its capacity carries over between reads.
+static std::string input;
+
+// index in input of the next queued command, or npos if there are
+// no commands waiting
+static std::string::size_type queuePos = std::string::npos;
+
+// bytes read from standard input that have not yet been split into
+// lines. The bytes still to be used are readBuf[readStart, readEnd).
+static char readBuf[4096];
+static std::size_t readStart = 0;
+static std::size_t readEnd = 0;
+
+// the function every line read is passed to (empty if none)
+static std::function<void(std::string_view)> inputRecorder;
+
+// lines being replayed as input, and the index of the next line. While
+// lines are replayed the output is held in replayOutput, and replayStdout
+// holds the buffer of std::cout (nullptr when not replaying).
+static std::string replayLines;
+static std::string::size_type replayPos = 0;
+static std::stringbuf replayOutput;
+static std::streambuf* replayStdout = nullptr;
+
+/***************************************************************************
+Ends a replay once the replayed lines have run out. The output held back
+since the last replayed line (ex. the prompt now waiting for input) is 
+printed and std::cout prints to the console again.
+***************************************************************************/
+
+static void endReplay()
+{
+	std::cout.rdbuf(replayStdout);
+	replayStdout = nullptr;
+	std::cout << replayOutput.str();
+	replayOutput.str("");
+	replayLines.clear();
+	replayPos = 0;
+}
+
+/***************************************************************************
+Takes the next replayed line (without the newline) into the parameter. The
+output held back so far answered prompts already replayed, so it is 
+dropped. Returns false, ending the replay, if the replayed lines have run 
+out.
+***************************************************************************/
+
+static bool replayLine(std::string &line)
+{
+	if (replayPos >= replayLines.length())
+	{
+		endReplay();
+		return false;
+	}
+
+	replayOutput.str("");
+	std::string::size_type newline = replayLines.find('\n', replayPos);
+	if (newline == std::string::npos)
+		newline = replayLines.length();
+	line.assign(replayLines, replayPos, newline - replayPos);
+	replayPos = newline + 1;
+	return true;
+}
+
+/***************************************************************************
+Reads the next line of standard input (without the newline) into the 
+parameter. Works like std::getline: returns false only if the input has
+ended before any characters were read. Anything waiting to be printed is 
+flushed before the program waits for input. Replayed lines are read before
+standard input, and every line read is passed to the input recorder.
+***************************************************************************/
+
+static bool readLine(std::string &line)
+{
+	line.clear();
+	if (replayStdout != nullptr && replayLine(line))
+	{
+		if (inputRecorder)
+			inputRecorder(line);
+		return true;
+	}
+
+	while (true)
+	{
+		const char* start = readBuf + readStart;
+		const char* newline = static_cast<const char*>(
+			memchr(start, '\n', readEnd - readStart));
+		if (newline != nullptr)
+		{
+			line.append(start, newline);
+			readStart = newline - readBuf + 1;
+			if (inputRecorder)
+				inputRecorder(line);
+			return true;
+		}
+
+		// keep the partial line and refill the buffer
+		line.append(start, readEnd - readStart);
+		readStart = 0;
+		readEnd = 0;
+
+		std::cout.flush();
+		ssize_t numRead = read(STDIN_FILENO, readBuf, sizeof(readBuf));
+		if (numRead < 0 && errno == EINTR)
+			continue;
+		if (numRead <= 0)
+		{
+			if (!line.empty() && inputRecorder)
+				inputRecorder(line);
+			return !line.empty();
+		}
+		readEnd = numRead;
+	}
+}
+
+/***************************************************************************
+Returns true if the character separates commands on a command line.
+***************************************************************************/
+
+static bool isSeparator(char c)
+{
+	return c == ' ' || c == '\t' || c == ',' || c == ';';
+}
+
+/***************************************************************************
+Returns the next entry to validate. If commands are queued, the next 
+command is removed from the queue and returned. Otherwise a new line is
+read and the line (without leading spaces or tabs) is returned as a single
+entry, unless the line starts with a letter. In that case the line is a 
+command line: its first command is returned and the rest are queued. The
+returned view points into the input buffer and is only valid until the 
+next read. The program exits if the input has ended.
+***************************************************************************/
+
+static std::string_view nextEntry()
+{
+	if (queuePos == std::string::npos)
+	{
+		if (!readLine(input))
+		{
+			// the input has ended (ex. a piped script ran out of
+			// lines), so no valid integer can ever be entered
+			std::cout << "\nEnd of input reached.\n";
+			std::exit(0);
+		}
+
+		std::string::size_type first = input.find_first_not_of(" \t");
+		if (first == std::string::npos)
+		{
+			return std::string_view();
+		}
+		if (!isalpha(static_cast<unsigned char>(input[first])))
+		{
+			return std::string_view(input).substr(first);
+		}
+		queuePos = first;
+	}
+
+	// take the command at the front of the queue
+	std::string::size_type end = queuePos;
+	while (end < input.length() && !isSeparator(input[end]))
+		end++;
+	std::string_view command(input.data() + queuePos, end - queuePos);
+
+	// move the front of the queue to the start of the next command
+	while (end < input.length() && isSeparator(input[end]))
+		end++;
+	queuePos = (end < input.length()) ? end : std::string::npos;
+
+	return command;
+}
+
+/***************************************************************************
+Reads a single entry and tries to turn it into a value. The first parameter
+holds the one letter commands that are accepted (a command at index i is
+returned as min + i). Otherwise the entry must be an integer: digits with
+an optional leading minus sign, and nothing else. The value is stored in 
+the last parameter and true is returned. If the entry is not valid, a 
+message is printed, any queued commands are dropped (they were meant for
+prompts that will not come) and false is returned.
+***************************************************************************/
+
+static bool readValue(const std::string &keys, int min, int &val)
+{
+	std::string_view entry = nextEntry();
+
+	if (entry.length() == 1 && isalpha(static_cast<unsigned char>(entry[0])))
+	{
+		std::string::size_type keyInd = keys.find(
+			static_cast<char>(tolower(static_cast<unsigned char>(entry[0]))));
+		if (keyInd != std::string::npos)
+		{
+			val = min + static_cast<int>(keyInd);
+			return true;
+		}
+	}
+
+	// from_chars accepts digits with an optional leading minus
+	// sign (which must be followed by a digit). The whole entry
+	// needs to be the number, so floating point numbers and any
+	// trailing characters are rejected.
+	bool outOfRange = false;
+	const char* last = entry.data() + entry.length();
+	std::from_chars_result result = std::from_chars(entry.data(), last, val);
+	if (result.ptr == last && !entry.empty())
+	{
+		if (result.ec == std::errc())
+			return true;
+		else if (result.ec == std::errc::result_out_of_range)
+			outOfRange = true;
+	}
+
+	clearQueuedInput();
+	if (outOfRange)
+		std::cout << "The value entered is out of range. "
+			  << "Please input a new value. " << std::endl;
+	else if (keys.find_first_not_of(' ') != std::string::npos)
+		std::cout << "A valid option was not entered. "
+			  << "Please type an option number or command and "
+			  << "press ENTER." << std::endl;
+	else
+		std::cout << "An integer value was not entered. "
+			  << "Please type an integer value and "
+			  << "press ENTER." << std::endl;
+	return false;
+}
 
 /***************************************************************************
-Two parameter int validation function. The function calls the default
-int validation function itself, but this function has the added capability
+Two parameter int validation function. The function works like the 
+default int validation function, but this function has the added capability
 of ensuring that the int entered is within a specified range. The first
 int parameter is treated as the minimum of the range and the second int
 parameter is treated as the maximum of the range (both inclusive). However,
@@ -41,6 +302,21 @@ the first parameter is treated as the maximum (and vice versa).
 ***************************************************************************/
 
 int intValid(int min, int max)
+{
+	return choiceValid(min, max, "");
+}
+
+/***************************************************************************
+Menu choice validation function. Works the same as the two parameter int
+validation function, but an option can also be chosen by its one letter
+command. The third parameter holds the command for each option in the 
+range: the character at index 0 is the command for min, the character at
+index 1 is the command for min + 1 and so on. A space means the option
+has no command. Commands are not case sensitive and should be stored in 
+lower case.
+***************************************************************************/
+
+int choiceValid(int min, int max, const std::string &keys)
 {
 	// if min is greater than max it is assumed the parameters
 	// were just entered in the wrong order
@@ -51,25 +327,55 @@ int intValid(int min, int max)
 		max = temp;
 	}
 
-	// use the default funtion and then check to make sure
-	// return value is in range	
-	int val = intValid();
-	if (val >= min && val <= max)
-		return val;
-	else
+	while (true)
 	{
-		while (!(val >= min && val <= max))
+		int val = 0;
+		if (readValue(keys, min, val))
 		{
+			if (val >= min && val <= max)
+				return val;
+
+			clearQueuedInput();
 			std::cout << "The entered value is not within "
 			     << "the specified range of " << min
 			     << " to " << max << " (inclusive).\n"
 			     << "Please enter a new value in this"
 			     << " range.\n";
-			val = intValid();
 		}
-		return val;
 	}
+}
+
+/***************************************************************************
+Takes a menu choice from the queued commands without reading a new line.
+The parameters are the same as for choiceValid, with the choice stored in
+the last parameter. Returns true if a queued command was a valid choice.
+Returns false if nothing is queued, or if the queued command was not valid
+(in which case a message is printed and the queue is dropped), so the 
+caller can show the prompt and read a new line.
+***************************************************************************/
 
+bool queuedChoice(int min, int max, const std::string &keys, int &val)
+{
+	if (!inputQueued())
+		return false;
+
+	if (min > max)
+	{
+		int temp = min;
+		min = max;
+		max = temp;
+	}
+
+	if (!readValue(keys, min, val))
+		return false;
+	if (val >= min && val <= max)
+		return true;
+
+	clearQueuedInput();
+	std::cout << "The entered value is not within "
+	     << "the specified range of " << min
+	     << " to " << max << " (inclusive).\n";
+	return false;
 }
 
 /***************************************************************************
@@ -78,74 +384,157 @@ and ensures that the input is an int value. It ensures this by re-prompting
 the user until a valid int is entered. If the value entered is a floating
 point number, the user will be re-prompted for input. 
 The function can handle all possible valid int inputs (from INT_MIN
-through INT_MAX). 
+through INT_MAX). Each line is read into the same buffer and parsed in
+place, so once the buffer has grown to fit the longest line no memory is
+allocated while reading input. If commands are queued from an earlier 
+command line, the next command is used instead of reading a new line.
 ***************************************************************************/
 
 int intValid()
 {
-	while(true)
+	int val = 0;
+	while (!readValue("", 0, val))
 	{
-		std::string input;
-		// variable will be set to true if an integral value is 
-		// input but it is out of range for int
-		bool outOfRange = false;
-		std::getline(std::cin, input);
-
-		// get i to index of first non-space and non-tab character
-		int i = 0;
-		while (i < input.length() && (input[i] == ' ' ||
-					      input[i] == '\t'))
-			i++;
-
-		// see if there is an integer starting from this index
-		if (input.length() > i && (isdigit(input[i])
-					   || input[i] == '-'))
+	}
+	return val;
+}
+
+/***************************************************************************
+Text validation function. Reads a single entry and returns it as text, 
+without any checks. The entry is the next queued command if there is one.
+Otherwise a new line is read, and a line starting with a letter is split
+into commands like any other command line, so several entries can be 
+typed on one line. A blank line gives an empty entry.
+***************************************************************************/
+
+std::string textValid()
+{
+	return std::string(nextEntry());
+}
+
+/***************************************************************************
+Returns true if commands from an earlier command line are still waiting
+to be used and false otherwise.
+***************************************************************************/
+
+bool inputQueued()
+{
+	return queuePos != std::string::npos;
+}
+
+/***************************************************************************
+Drops any commands that are still waiting to be used. No return value.
+***************************************************************************/
+
+void clearQueuedInput()
+{
+	queuePos = std::string::npos;
+}
+
+/***************************************************************************
+Returns true if a whole line of standard input (ending with a newline) has
+been read into the buffer but not yet used.
+***************************************************************************/
+
+static bool lineBuffered()
+{
+	return memchr(readBuf + readStart, '\n', readEnd - readStart) != nullptr;
+}
+
+/***************************************************************************
+Waits up to the given number of milliseconds for a line of input. Returns
+true straight away if commands are queued, lines are being replayed or a 
+whole line has already been read but not used. Otherwise the input that 
+arrives is added to the buffer, and true is returned once a whole line is
+buffered (or the input ends, or the line is too long for the buffer) and 
+false if the time runs out first. A partial line is kept in the buffer, so
+reading it can not hold up the caller. A negative timeout waits without a
+limit.
+***************************************************************************/
+
+bool waitForInput(int timeoutMs)
+{
+	if (replayStdout != nullptr)
+	{
+		if (replayPos < replayLines.length())
+			return true;
+		endReplay();
+	}
+	if (inputQueued() || lineBuffered())
+		return true;
+
+	std::cout.flush();
+	std::chrono::steady_clock::time_point deadline = 
+		std::chrono::steady_clock::now() 
+		+ std::chrono::milliseconds(timeoutMs);
+	while (true)
+	{
+		int waitMs = -1;
+		if (timeoutMs >= 0)
 		{
-			// make sure if there is minus sign, there is 
-			// an integer following the sign		
-			if (input[i] != '-' || (input.length() > i + 1 &&
-						isdigit(input[i + 1])))
-			{
-				std::string str = "";
-				str += input[i];
-				i++;
-				// continue adding digits while there are
-				// more in input
-				while (i < input.length() && isdigit(input[i]))
-				{	
-					str += input[i];
-					i++;
-				}
-				// make sure the number entered is not a
-				// floating point number and there is no
-				// additional characters after the numeric input
-				if (i == input.length())
-				{
-					// make sure integer is not too large.
-					// copy string into c-string to allow
-					// use of the strtoll function		
-					char* cstr = new char[str.length() + 1];
-					for (int m = 0; m < str.length(); m++)
-						cstr[m] = str[m];
-					cstr[str.length()] = '\0';	
-					long long int val =
-						     strtoll(cstr, nullptr, 10);
-					delete[] cstr;
-					cstr = nullptr;
-
-					if (val <= INT_MAX && val >= INT_MIN)
-						return val;
-					else
-						outOfRange = true;
-				}			
-			}	
+			std::chrono::steady_clock::duration left = 
+				deadline - std::chrono::steady_clock::now();
+			waitMs = std::max<long long>(0, std::chrono::duration_cast<
+				std::chrono::milliseconds>(left).count());
 		}
-		if (outOfRange)
-			std::cout << "The value entered is out of range. "
-				  << "Please input a new value. " << std::endl;
-		else
-			std::cout << "An integer value was not entered. "
-				  << "Please type an integer value and "
-				  << "press ENTER." << std::endl;
+
+		pollfd stdinPoll{ STDIN_FILENO, POLLIN, 0 };
+		int ready = poll(&stdinPoll, 1, waitMs);
+		if (ready < 0 && errno == EINTR)
+			continue;
+		if (ready <= 0)
+			return false;
+
+		// move the partial line to the front of the buffer and add
+		// the input that has arrived after it
+		std::memmove(readBuf, readBuf + readStart, readEnd - readStart);
+		readEnd -= readStart;
+		readStart = 0;
+		if (readEnd == sizeof(readBuf))
+			return true;
+
+		ssize_t numRead = read(STDIN_FILENO, readBuf + readEnd, 
+			sizeof(readBuf) - readEnd);
+		if (numRead < 0 && errno == EINTR)
+			continue;
+		// readLine reports the end of the input (or uses the last
+		// line if it has no newline)
+		if (numRead <= 0)
+			return true;
+		readEnd += numRead;
+		if (lineBuffered())
+			return true;
 	}
 }
+
+/***************************************************************************
+Sets the function that every line of input is passed to once it is read 
+(without the newline). Replayed lines are passed to it as well, so a 
+journal of the input stays complete across a replay. An empty function
+turns recording off. No return value.
+***************************************************************************/
+
+void setInputRecorder(std::function<void(std::string_view)> recorder)
+{
+	inputRecorder = std::move(recorder);
+}
+
+/***************************************************************************
+Replays lines as input (ex. the input journaled since a game was last 
+saved). The parameter holds the lines, each ending with a newline. They
+are read before any more standard input, and the output printed while 
+they are replayed is held back: once they run out, only the output since
+the last replayed line is printed, which leaves the player at the prompt
+the replay stopped at. No return value.
+***************************************************************************/
+
+void replayInput(const std::string &lines)
+{
+	if (lines.empty() || replayStdout != nullptr)
+		return;
+
+	replayLines = lines;
+	replayPos = 0;
+	replayOutput.str("");
+	replayStdout = std::cout.rdbuf(&replayOutput);
+}
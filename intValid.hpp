@@ -20,11 +20,37 @@
 **		the parameters were entered in the wrong order and 
 **		the min parameter is treated as the max (and vice
 **		versa). 
+**		* Updated - input lines are read into a reused buffer
+**		and parsed with std::from_chars rather than being
+**		copied into temporary strings. The program exits if
+**		the input ends before a valid integer is entered.
+**		* Updated - a line starting with a letter is read as
+**		a command line. It is split into commands (separated
+**		by spaces, tabs, commas or semicolons) that are queued
+**		and handed out one per prompt, so several prompts can
+**		be answered with one line (ex. "m r" or "b 2 3"). Menu
+**		options can be chosen by their one letter command
+**		through the choiceValid function.
+**		* Updated - input is read straight from the standard
+**		input file descriptor so that waitForInput can wait for
+**		a line with a timeout (used by the real-time game).
+**		* Updated - the textValid function reads a single entry
+**		as text (ex. the start of a guest's name).
+**		* Updated - every line read can be passed to a recorder
+**		(used to journal the player's input), and lines can be
+**		replayed as input before standard input is read. The
+**		output printed while replaying is held back, and only
+**		the output since the last replayed line is shown once
+**		the replayed lines run out.
 *********************************************************************/
 
 #ifndef INTVALID_HPP
 #define INTVALID_HPP
 
+#include <string>
+#include <string_view>
+#include <functional>
+
 // default int validation function. It simply ensures that a valid integer
 // value is input by re-prompting until such a value is entered. That value
 // is then returned by the function.
@@ -34,5 +60,33 @@ int intValid();
 // within a specified range. The first parameter is the minimum of the range
 // (inclusive) and the second parameter is the maximum of the range (inclusive)
 int intValid(int min, int max);
+// menu choice validation function. It works the same as the two parameter
+// function, but an option can also be chosen with its one letter command.
+// The third parameter holds the command for each option in the range (index
+// 0 for min, index 1 for min + 1, ...), with a space for no command.
+int choiceValid(int min, int max, const std::string &keys);
+// reads a single entry as text: the next queued command, or else a new line
+// of input (split into commands if it starts with a letter). Returns the 
+// entry, which is empty for a blank line.
+std::string textValid();
+// takes a menu choice (stored in the last parameter) from the queued commands
+// without reading a new line. Returns false if nothing is queued or the queued
+// command is not a valid choice, in which case the queue is dropped.
+bool queuedChoice(int min, int max, const std::string &keys, int &val);
+// returns true if commands from an earlier command line are still waiting
+bool inputQueued();
+// drops any commands that are still waiting
+void clearQueuedInput();
+// waits up to the given number of milliseconds (no limit if negative) for a
+// whole line of input. Returns true if a line is available and false if the
+// time ran out (a partial line is kept until the rest of it arrives).
+bool waitForInput(int timeoutMs);
+// sets the function that every line of input read is passed to (without the
+// newline), including replayed lines. An empty function turns recording off.
+void setInputRecorder(std::function<void(std::string_view)> recorder);
+// replays the given lines (each ending with a newline) as input before any
+// more standard input is read. The output is held back until the replayed
+// lines run out.
+void replayInput(const std::string &lines);
 
 #endif
@@ -6,25 +6,213 @@
 **				The program simply allows the console user to either
 **				start and play Find the Thief games (in which case
 **				all of the game flow / functionality is handled by
-**				the ThiefGame class) or to exit the program.
+**				the ThiefGame class) or to exit the program. Games
+**				can be played turn by turn or in real time.
+**				If the program is run with "--events <fd>", a binary
+**				record of every game is written to the file 
+**				descriptor <fd> for viewers (see EventStream.hpp).
+**				If it is run with "--moving-guests", the guests 
+**				wander around the room during the party, and with
+**				"--culprits <n>" (2 or 3) the thief has accomplices.
+**				With "--save <file>", a game can be saved to <file>
+**				from the main menu of the game, and a game saved
+**				there is resumed when the program next starts.
+**				"--room <file>" plays every game in the prebuilt room
+**				in <file> (see RoomLayout.hpp), and "--make-room
+**				<file>" writes a room set up at random to <file> as
+**				a prebuilt room and exits.
+**				With "--journal <file>", the game being played is
+**				journaled to <file> (see GameJournal.hpp), and a game
+**				left in the journal when the program died is restored
+**				when the program next starts.
 *********************************************************************/
 
 #include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <csignal>
+#include <unistd.h>
 #include "ThiefGame.hpp"
+#include "EventStream.hpp"
+#include "GameOptions.hpp"
+#include "CulpritSolver.hpp"
+#include "Snapshot.hpp"
+#include "RoomLayout.hpp"
+#include "GameJournal.hpp"
 #include "Menu.hpp"
+#include "intValid.hpp"
 
-int main()
+/*********************************************************************
+Plays a game. The first parameter is the game, the second is the
+stream its events are written to (nullptr if none) and the third 
+is the file it can be saved to (nullptr if none). The game is
+journaled to the file whose path is the last parameter (nullptr if
+none) while it is played, and the journal is removed once the game
+is over or has been saved. No return value.
+*********************************************************************/
+
+static void playGame(ThiefGame &game, EventStream* events, 
+	const char* saveFile, GameJournal &journal, const char* journalFile)
+{
+	game.setEventStream(events);
+	game.setSaveFile(saveFile);
+	if (journalFile != nullptr 
+		&& journal.open(journalFile, GameJournal::DEFAULT_SYNC_MS))
+	{
+		game.setJournal(&journal);
+	}
+	game.runGame();
+	game.setJournal(nullptr);
+	journal.discard();
+}
+
+int main(int argc, char* argv[])
 {	
+	// set up the event stream, the moving guests and the number of
+	// culprits if they were asked for
+	EventStream* events = nullptr;
+	bool movingGuests = false;
+	int numCulprits = 1;
+	const char* saveFile = nullptr;
+	const char* roomFile = nullptr;
+	const char* makeRoomFile = nullptr;
+	const char* journalFile = nullptr;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string arg(argv[i]);
+		if (arg == "--events" && i + 1 < argc && events == nullptr)
+		{
+			// a viewer closing its end of a pipe should not end
+			// the program
+			signal(SIGPIPE, SIG_IGN);
+			events = new EventStream(std::atoi(argv[++i]));
+		}
+		else if (arg == "--moving-guests")
+		{
+			movingGuests = true;
+		}
+		else if (arg == "--culprits" && i + 1 < argc)
+		{
+			numCulprits = std::atoi(argv[++i]);
+			if (numCulprits < 1 || numCulprits > CulpritSolver::MAX_CULPRITS)
+			{
+				numCulprits = 1;
+			}
+		}
+		else if (arg == "--save" && i + 1 < argc)
+		{
+			saveFile = argv[++i];
+		}
+		else if (arg == "--room" && i + 1 < argc)
+		{
+			roomFile = argv[++i];
+		}
+		else if (arg == "--make-room" && i + 1 < argc)
+		{
+			makeRoomFile = argv[++i];
+		}
+		else if (arg == "--journal" && i + 1 < argc)
+		{
+			journalFile = argv[++i];
+		}
+	}
+
+	// a room set up at random is kept as a prebuilt room
+	if (makeRoomFile != nullptr)
+	{
+		GameOptions options;
+		options.numCulprits = numCulprits;
+		ThiefGame roomGame(options);
+		if (!roomGame.writeLayout(makeRoomFile))
+		{
+			std::cout << "The room could not be written.\n";
+			return 1;
+		}
+		return 0;
+	}
+
+	// the prebuilt room is opened once and shared by every game
+	const RoomLayout* layout = nullptr;
+	if (roomFile != nullptr)
+	{
+		layout = RoomLayout::open(roomFile);
+		if (layout == nullptr)
+		{
+			std::cout << "\nThe room could not be read, so rooms are "
+				<< "set up at random.\n";
+		}
+	}
+
+	// a game left in the journal was cut short, so it is restored
+	// from its last snapshot and the input entered after it
+	GameJournal journal;
+	if (journalFile != nullptr 
+		&& !journal.open(journalFile, GameJournal::DEFAULT_SYNC_MS))
+	{
+		std::cout << "\nThe journal file could not be opened (it may not "
+			<< "be a journal), so\ngames will not be journaled.\n";
+		journalFile = nullptr;
+	}
+	else if (journal.hasSnapshot())
+	{
+		const std::vector<unsigned char> &lastSnapshot = 
+			journal.getSnapshot();
+		ThiefGame* lostGame = ThiefGame::load(lastSnapshot.data(),
+			lastSnapshot.size());
+		if (lostGame == nullptr)
+		{
+			std::cout << "\nThe journaled game could not be read.\n";
+		}
+		else
+		{
+			std::cout << "\nThe last game was cut short and has been "
+				<< "restored.\n";
+			replayInput(journal.getTail());
+			playGame(*lostGame, events, saveFile, journal, journalFile);
+			delete lostGame;
+			std::cout << "\n";
+		}
+	}
+	journal.discard();
+
+	// a game left in the save file is picked up where the player
+	// left it. The file is removed once the game is over.
+	std::vector<unsigned char> snapshot;
+	if (saveFile != nullptr && readSnapshotFile(saveFile, snapshot))
+	{
+		ThiefGame* savedGame = ThiefGame::load(snapshot.data(), 
+			snapshot.size());
+		if (savedGame == nullptr)
+		{
+			std::cout << "\nThe saved game could not be read.\n";
+		}
+		else
+		{
+			playGame(*savedGame, events, saveFile, journal, journalFile);
+			if (savedGame->isFinished())
+			{
+				unlink(saveFile);
+			}
+			delete savedGame;
+			std::cout << "\n";
+		}
+	}
+
 	// set up the menu for starting the game / exiting the program
 	const std::string startGame{ "Start a game of Find the Thief" };
+	const std::string startRealTime{ "Start a real-time game of Find "
+		"the Thief" };
 	const std::string exit{ "Exit the program" };
 
 	Menu startMenu;
 	startMenu.addOption(startGame);
+	startMenu.addOption(startRealTime);
 	startMenu.addOption(exit);
 
 	enum MenuChoice {
 		START = 1,
+		REAL_TIME,
 		EXIT
 	};
 
@@ -34,12 +222,33 @@ int main()
 	// doesn't want to exit
 	while (curChoice != EXIT)
 	{
-		ThiefGame newGame;
-		newGame.runGame();
+		GameOptions options;
+		options.movingGuests = movingGuests;
+		options.numCulprits = numCulprits;
+		if (curChoice == REAL_TIME)
+		{
+			std::cout << "\nHow many seconds should each minute of the "
+				<< "party last? (1 to 60)\n";
+			options.minuteMs = intValid(1, 60) * 1000;
+		}
+
+		ThiefGame* newGame = nullptr;
+		if (layout != nullptr)
+		{
+			newGame = ThiefGame::fromLayout(options, *layout);
+		}
+		if (newGame == nullptr)
+		{
+			newGame = new ThiefGame(options);
+		}
+		playGame(*newGame, events, saveFile, journal, journalFile);
+		delete newGame;
 		
 		std::cout << "\n";		
 		curChoice = static_cast<MenuChoice>(startMenu.chooseOption());
 	}
+
+	delete events;
 		
 	return 0;
 }